@@ -0,0 +1,459 @@
+// Compiles a text maze (see levels/classic.txt) into a C source for the kernel:
+//  - the cells, in the encoding of the engine's landscape
+//  - the next hop table: the first move of a shortest path between any two walkable cells
+//  - the junction graph: the cells where a choice is made and the corridors between them
+//
+// or, with --binary, into a level file the kernel loads from the floppy
+// (see src/kernel/pacman/level_file.h): the maze, its passability and its
+// pellets the way the engine keeps them.
+//
+// Usage: level_compiler <maze.txt> <level_gen.c> <level_gen.h>
+//        level_compiler --binary <maze.txt> <level.lvl>
+//
+// This is a host tool, it's built with the host compiler and runs at build time.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <pacman/level_file.h>
+
+#define MAX_ROWS        64
+#define MAX_COLS        64
+#define MAX_CELLS       (MAX_ROWS * MAX_COLS)
+#define NO_CELL         -1
+#define NO_JUNCTION     0xFF
+#define NO_COMPONENT    0xFF        // g_LevelComponent is uint8_t, 255 pieces at most
+
+enum { TILE_PATH = 0, TILE_WALL = 1, TILE_DOT = 2, TILE_POWER = 3, TILE_DOOR = 4, TILE_PACMAN = 9 };
+enum { LEFT = 0, RIGHT = 1, UP = 2, DOWN = 3 };
+
+static int g_Rows, g_Cols;
+static uint8_t g_Tiles[MAX_CELLS];
+
+static int g_WalkableCount;
+static int g_Walkable[MAX_CELLS];           // walkable index -> cell
+static int g_WalkableIndex[MAX_CELLS];      // cell -> walkable index, -1 for walls
+static uint8_t g_Component[MAX_CELLS];      // connected component of each walkable cell
+
+static int g_JunctionCount;
+static int g_Junctions[256];
+static int g_JunctionIndex[MAX_CELLS];
+
+static void Fail(const char* message, const char* detail)
+{
+    fprintf(stderr, "level_compiler: %s%s\n", message, detail);
+    exit(1);
+}
+
+static int Tile(char c)
+{
+    switch (c) {
+    case '#': return TILE_WALL;
+    case ' ': return TILE_PATH;
+    case '.': return TILE_DOT;
+    case '*': return TILE_POWER;
+    case '-': return TILE_DOOR;
+    case 'C': return TILE_PACMAN;
+    case '5': case '6': case '7': case '8': return c - '0';
+    default: return -1;
+    }
+}
+
+static void ReadMaze(const char* path)
+{
+    char line[256];
+    FILE* file = fopen(path, "r");
+    if (!file)
+        Fail("can't open ", path);
+
+    for (int i = 0; i < MAX_CELLS; i++)
+        g_Tiles[i] = TILE_PATH;
+
+    while (fgets(line, sizeof(line), file)) {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[0] == ';')
+            continue;
+        if (g_Rows == MAX_ROWS)
+            Fail("too many rows in ", path);
+
+        int length = strlen(line);
+        if (length > MAX_COLS)
+            Fail("row too long in ", path);
+        if (length > g_Cols)
+            g_Cols = length;
+
+        // missing characters at the end of a row are spaces
+        for (int x = 0; x < length; x++) {
+            int tile = Tile(line[x]);
+            if (tile < 0)
+                Fail("unknown character in ", line);
+            g_Tiles[g_Rows * MAX_COLS + x] = tile;
+        }
+        g_Rows++;
+    }
+    fclose(file);
+
+    // compact the rows
+    for (int y = 0; y < g_Rows; y++)
+        for (int x = 0; x < g_Cols; x++)
+            g_Tiles[y * g_Cols + x] = g_Tiles[y * MAX_COLS + x];
+}
+
+static int Walkable(int cell)
+{
+    return g_Tiles[cell] != TILE_WALL;
+}
+
+// The same neighbors as Maze_Load() in the kernel: the left and the right edges wrap around
+static int Neighbor(int cell, int direction)
+{
+    int x = cell % g_Cols, y = cell / g_Cols;
+
+    switch (direction) {
+    case LEFT:  x = (x + g_Cols - 1) % g_Cols; break;
+    case RIGHT: x = (x + 1) % g_Cols; break;
+    case UP:    y--; break;
+    case DOWN:  y++; break;
+    }
+    if (y < 0 || y >= g_Rows)
+        return NO_CELL;
+
+    int next = y * g_Cols + x;
+    return Walkable(cell) && Walkable(next) ? next : NO_CELL;
+}
+
+static int ExitCount(int cell)
+{
+    int count = 0;
+    for (int d = LEFT; d <= DOWN; d++)
+        count += Neighbor(cell, d) != NO_CELL;
+    return count;
+}
+
+// Distances from the source, -1 where it can't go. If firstMove isn't NULL it
+// gets the direction of the first move on a shortest path to each cell.
+static void Bfs(int source, int* distance, int* firstMove)
+{
+    static int queue[MAX_CELLS];
+    int head = 0, tail = 0;
+
+    for (int i = 0; i < g_Rows * g_Cols; i++)
+        distance[i] = -1;
+
+    distance[source] = 0;
+    queue[tail++] = source;
+    while (head < tail) {
+        int cell = queue[head++];
+        for (int d = LEFT; d <= DOWN; d++) {
+            int next = Neighbor(cell, d);
+            if (next != NO_CELL && distance[next] < 0) {
+                distance[next] = distance[cell] + 1;
+                if (firstMove)
+                    firstMove[next] = cell == source ? d : firstMove[cell];
+                queue[tail++] = next;
+            }
+        }
+    }
+}
+
+static void FindWalkable()
+{
+    static int distance[MAX_CELLS];
+    int components = 0;
+
+    for (int cell = 0; cell < g_Rows * g_Cols; cell++) {
+        g_WalkableIndex[cell] = -1;
+        if (Walkable(cell)) {
+            g_WalkableIndex[cell] = g_WalkableCount;
+            g_Walkable[g_WalkableCount++] = cell;
+        }
+    }
+
+    for (int i = 0; i < g_WalkableCount; i++)
+        g_Component[i] = NO_COMPONENT;
+
+    for (int i = 0; i < g_WalkableCount; i++) {
+        if (g_Component[i] != NO_COMPONENT)
+            continue;
+        if (components == NO_COMPONENT)
+            Fail("too many components", "");
+        Bfs(g_Walkable[i], distance, NULL);
+        for (int j = 0; j < g_WalkableCount; j++)
+            if (distance[g_Walkable[j]] >= 0)
+                g_Component[j] = components;
+        components++;
+    }
+}
+
+// Dead ends and forks are junctions, the cells with two exits are corridors
+static void FindJunctions()
+{
+    for (int cell = 0; cell < g_Rows * g_Cols; cell++) {
+        g_JunctionIndex[cell] = NO_JUNCTION;
+        if (Walkable(cell) && ExitCount(cell) != 2) {
+            if (g_JunctionCount == NO_JUNCTION)
+                Fail("too many junctions", "");
+            g_JunctionIndex[cell] = g_JunctionCount;
+            g_Junctions[g_JunctionCount++] = cell;
+        }
+    }
+}
+
+// Follows the corridor leaving the junction in the direction, up to the next junction
+static void FollowCorridor(int junction, int direction, int* target, int* length)
+{
+    int previous = g_Junctions[junction];
+    int cell = Neighbor(previous, direction);
+
+    *target = NO_JUNCTION;
+    *length = 0;
+    if (cell == NO_CELL)
+        return;
+
+    for (int steps = 1; steps <= g_Rows * g_Cols; steps++) {
+        if (g_JunctionIndex[cell] != NO_JUNCTION) {
+            *target = g_JunctionIndex[cell];
+            *length = steps;
+            return;
+        }
+
+        // a corridor cell has exactly two exits, take the one we didn't come from
+        int next = NO_CELL;
+        for (int d = LEFT; d <= DOWN; d++) {
+            int candidate = Neighbor(cell, d);
+            if (candidate != NO_CELL && candidate != previous)
+                next = candidate;
+        }
+        previous = cell;
+        cell = next;
+    }
+}
+
+// Array initializers, 16 values per line
+static const char* Separator(int i)
+{
+    return i == 0 ? "\n    " : i % 16 ? ", " : ",\n    ";
+}
+
+static void WriteSource(const char* path, const char* source)
+{
+    static int distance[MAX_CELLS];
+    FILE* out = fopen(path, "w");
+    if (!out)
+        Fail("can't write ", path);
+
+    fprintf(out, "// !!! THIS FILE IS AUTOGENERATED from %s by build_scripts/level_compiler.c !!!\n", source);
+    fprintf(out, "#include \"level.h\"\n\n");
+
+    // the cells
+    fprintf(out, "const uint8_t g_LevelLandscape[LEVEL_ROWS][LEVEL_COLS] = {\n");
+    for (int y = 0; y < g_Rows; y++) {
+        fprintf(out, "    {");
+        for (int x = 0; x < g_Cols; x++)
+            fprintf(out, "%s%d", x ? ", " : " ", g_Tiles[y * g_Cols + x]);
+        fprintf(out, " },\n");
+    }
+    fprintf(out, "};\n\n");
+
+    // walkable cells
+    fprintf(out, "const uint16_t g_LevelWalkableCount = %d;\n\n", g_WalkableCount);
+    fprintf(out, "const uint16_t g_LevelWalkableIndex[LEVEL_CELLS] = {");
+    for (int cell = 0; cell < g_Rows * g_Cols; cell++)
+        fprintf(out, "%s%d", Separator(cell), g_WalkableIndex[cell] < 0 ? 0xFFFF : g_WalkableIndex[cell]);
+    fprintf(out, "\n};\n\n");
+
+    fprintf(out, "const uint8_t g_LevelComponent[LEVEL_WALKABLE] = {");
+    for (int i = 0; i < g_WalkableCount; i++)
+        fprintf(out, "%s%d", Separator(i), g_Component[i]);
+    fprintf(out, "\n};\n\n");
+
+    // the next hops, 2 bits per pair, LEFT for the pairs without a path
+    fprintf(out, "const uint8_t g_LevelNextHop[LEVEL_WALKABLE][LEVEL_NEXT_HOP_BYTES] = {\n");
+    for (int from = 0; from < g_WalkableCount; from++) {
+        static int firstMove[MAX_CELLS];
+        Bfs(g_Walkable[from], distance, firstMove);
+
+        fprintf(out, "    {");
+        for (int to = 0; to < g_WalkableCount; to += 4) {
+            uint8_t packed = 0;
+            for (int i = 0; i < 4 && to + i < g_WalkableCount; i++) {
+                int target = g_Walkable[to + i];
+                if (distance[target] > 0)
+                    packed |= firstMove[target] << (2 * i);
+            }
+            fprintf(out, "%s0x%02x", to ? ", " : " ", packed);
+        }
+        fprintf(out, " },\n");
+    }
+    fprintf(out, "};\n\n");
+
+    // the junction graph
+    fprintf(out, "const uint8_t g_LevelJunctionCount = %d;\n\n", g_JunctionCount);
+    fprintf(out, "const uint8_t g_LevelCellJunction[LEVEL_CELLS] = {");
+    for (int cell = 0; cell < g_Rows * g_Cols; cell++)
+        fprintf(out, "%s%d", Separator(cell), g_JunctionIndex[cell]);
+    fprintf(out, "\n};\n\n");
+
+    fprintf(out, "const LevelJunction g_LevelJunctions[LEVEL_JUNCTIONS] = {\n");
+    for (int j = 0; j < g_JunctionCount; j++) {
+        int target[4], length[4];
+        for (int d = LEFT; d <= DOWN; d++)
+            FollowCorridor(j, d, &target[d], &length[d]);
+
+        for (int d = LEFT; d <= DOWN; d++)
+            if (length[d] > 255)
+                Fail("corridor too long", "");
+
+        fprintf(out, "    { .Cell = %d, .Next = { %d, %d, %d, %d }, .Length = { %d, %d, %d, %d } },\n",
+            g_Junctions[j], target[0], target[1], target[2], target[3],
+            length[0], length[1], length[2], length[3]);
+    }
+    fprintf(out, "};\n");
+
+    fclose(out);
+}
+
+// checksum is the one of the level's file, the kernel knows the file by it
+static void WriteHeader(const char* path, const char* source, uint32_t checksum)
+{
+    FILE* out = fopen(path, "w");
+    if (!out)
+        Fail("can't write ", path);
+
+    fprintf(out, "// !!! THIS FILE IS AUTOGENERATED from %s by build_scripts/level_compiler.c !!!\n", source);
+    fprintf(out, "#pragma once\n\n");
+    fprintf(out, "#define LEVEL_ROWS              %d\n", g_Rows);
+    fprintf(out, "#define LEVEL_COLS              %d\n", g_Cols);
+    fprintf(out, "#define LEVEL_WALKABLE          %d\n", g_WalkableCount);
+    fprintf(out, "#define LEVEL_JUNCTIONS         %d\n", g_JunctionCount);
+    fprintf(out, "#define LEVEL_FILE_CHECKSUM     0x%08x\n", checksum);
+    fclose(out);
+}
+
+//
+// Binary levels
+//
+
+#define ROW_BITS        32
+
+static uint32_t Align(uint32_t offset)
+{
+    return (offset + 3) & ~3u;
+}
+
+static void SetBit(uint64_t* bitboard, int cell)
+{
+    int bit = (cell / g_Cols) * ROW_BITS + cell % g_Cols;
+    bitboard[bit / 64] |= 1ull << (bit % 64);
+}
+
+static uint8_t g_File[0x10000];
+
+// The same cells, neighbors and bitboards as Maze_Load() and Pellets_Load()
+// in the kernel, into g_File. Returns the header.
+static LevelFileHeader BuildBinary(const char* path)
+{
+    uint8_t* file = g_File;
+    int cells = g_Rows * g_Cols;
+    int words = (g_Rows + 1) / 2;
+    LevelFileHeader header = {
+        .Magic = LEVEL_FILE_MAGIC,
+        .Version = LEVEL_FILE_VERSION,
+        .HeaderSize = sizeof(LevelFileHeader),
+        .Rows = g_Rows,
+        .Cols = g_Cols,
+        .RowBits = ROW_BITS,
+    };
+
+    if (g_Cols > ROW_BITS)
+        Fail("the rows are too long for the bitboards in ", path);
+
+    header.CellsOffset = Align(sizeof(LevelFileHeader));
+    header.NeighborsOffset = Align(header.CellsOffset + cells);
+    header.BitboardsOffset = Align(header.NeighborsOffset + cells * 4 * sizeof(uint16_t));
+    header.SpawnsOffset = header.BitboardsOffset + LEVEL_BITBOARDS * words * sizeof(uint64_t);
+
+    uint8_t* cellsOut = file + header.CellsOffset;
+    uint16_t* neighborsOut = (uint16_t*)(file + header.NeighborsOffset);
+    uint64_t* bitboards = (uint64_t*)(file + header.BitboardsOffset);
+    LevelFileSpawn* spawns = (LevelFileSpawn*)(file + header.SpawnsOffset);
+
+    for (int cell = 0; cell < cells; cell++) {
+        int tile = g_Tiles[cell];
+        int x = cell % g_Cols;
+        uint8_t exits = 0;
+
+        for (int d = LEFT; d <= DOWN; d++) {
+            int next = Neighbor(cell, d);
+            neighborsOut[cell * 4 + d] = next != NO_CELL ? next : cell;
+            if (next == NO_CELL)
+                continue;
+
+            exits |= 1 << d;
+            bool wraps = (d == LEFT && x == 0) || (d == RIGHT && x == g_Cols - 1);
+            if (wraps)
+                SetBit(&bitboards[(d == LEFT ? LEVEL_BITBOARD_WRAP_LEFT : LEVEL_BITBOARD_WRAP_RIGHT) * words], cell);
+            else
+                SetBit(&bitboards[(LEVEL_BITBOARD_EXITS + d) * words], cell);
+        }
+        cellsOut[cell] = (tile <= TILE_DOOR ? tile : TILE_PATH) | (exits << 4);
+
+        if (Walkable(cell)) {
+            SetBit(&bitboards[LEVEL_BITBOARD_WALKABLE * words], cell);
+            header.Walkable++;
+        }
+        if (tile == TILE_DOT || tile == TILE_POWER) {
+            SetBit(&bitboards[(tile == TILE_DOT ? LEVEL_BITBOARD_DOTS : LEVEL_BITBOARD_POWERS) * words], cell);
+            header.Pellets++;
+        }
+        if (tile == TILE_PACMAN || (tile >= LEVEL_SPAWN_GHOST && tile < LEVEL_SPAWN_GHOST + LEVEL_SPAWN_GHOST_KINDS)) {
+            if (header.SpawnCount == 255)
+                Fail("too many spawn points in ", path);
+            spawns[header.SpawnCount].Cell = cell;
+            spawns[header.SpawnCount].Kind = tile;
+            header.SpawnCount++;
+        }
+    }
+
+    header.Size = header.SpawnsOffset + header.SpawnCount * sizeof(LevelFileSpawn);
+    uint32_t hash = 2166136261u;
+    for (uint32_t i = header.HeaderSize; i < header.Size; i++)
+        hash = (hash ^ file[i]) * 16777619u;
+    header.Checksum = hash;
+    memcpy(file, &header, sizeof(header));
+    return header;
+}
+
+static void WriteBinary(const char* path)
+{
+    LevelFileHeader header = BuildBinary(path);
+
+    FILE* out = fopen(path, "wb");
+    if (!out || fwrite(g_File, 1, header.Size, out) != header.Size)
+        Fail("can't write ", path);
+    fclose(out);
+}
+
+int main(int argc, char** argv)
+{
+    if (argc == 4 && strcmp(argv[1], "--binary") == 0) {
+        ReadMaze(argv[2]);
+        WriteBinary(argv[3]);
+        return 0;
+    }
+
+    if (argc != 4) {
+        fprintf(stderr, "Usage: level_compiler <maze.txt> <level_gen.c> <level_gen.h>\n");
+        fprintf(stderr, "       level_compiler --binary <maze.txt> <level.lvl>\n");
+        return 1;
+    }
+
+    ReadMaze(argv[1]);
+    FindWalkable();
+    FindJunctions();
+    WriteSource(argv[2], argv[1]);
+    // 0 for a maze too wide for the bitboards of a level file
+    WriteHeader(argv[3], argv[1], g_Cols <= ROW_BITS ? BuildBinary(argv[3]).Checksum : 0);
+    return 0;
+}
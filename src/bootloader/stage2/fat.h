@@ -39,6 +39,7 @@ enum FAT_Attributes
 
 bool FAT_Initialize(DISK* disk);
 FAT_File* FAT_Open(DISK* disk, const char* path);
+FAT_File* FAT_OpenEntry(DISK* disk, FAT_DirectoryEntry* entry);
 uint32_t FAT_Read(DISK* disk, FAT_File* file, uint32_t byteCount, void* dataOut);
 bool FAT_ReadEntry(DISK* disk, FAT_File* file, FAT_DirectoryEntry* dirEntry);
 void FAT_Close(FAT_File* file);
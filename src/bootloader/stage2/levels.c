@@ -0,0 +1,68 @@
+#include "levels.h"
+#include "fat.h"
+#include "memdefs.h"
+#include "memory.h"
+#include "stdio.h"
+#include <stddef.h>
+
+static inline uint64_t rdtsc()
+{
+    uint32_t low, high;
+    __asm__ volatile ("rdtsc" : "=a"(low), "=d"(high));
+    return ((uint64_t)high << 32) | low;
+}
+
+static bool IsLevel(const FAT_DirectoryEntry* entry)
+{
+    return entry->Name[0] != 0xE5
+        && !(entry->Attributes & (FAT_ATTRIBUTE_DIRECTORY | FAT_ATTRIBUTE_VOLUME_ID))
+        && memcmp(entry->Name + 8, "LVL", 3) == 0;
+}
+
+void LEVELS_Load(DISK* disk)
+{
+    LEVELS_Directory* directory = (LEVELS_Directory*)MEMORY_LEVELS_ADDR;
+    uint8_t* next = (uint8_t*)MEMORY_LEVELS_ADDR + sizeof(LEVELS_Directory);
+    uint8_t* end = (uint8_t*)MEMORY_LEVELS_ADDR + MEMORY_LEVELS_SIZE;
+
+    // an empty directory tells the kernel to play its compiled level
+    directory->Magic = LEVELS_MAGIC;
+    directory->Count = 0;
+
+    FAT_File* dir = FAT_Open(disk, "/levels");
+    if (dir == NULL)
+        return;
+
+    FAT_DirectoryEntry entry;
+    while (FAT_ReadEntry(disk, dir, &entry) && entry.Name[0] != 0)
+    {
+        if (!IsLevel(&entry))
+            continue;
+
+        if (directory->Count == LEVELS_MAX || entry.Size > (uint32_t)(end - next))
+        {
+            printf("Levels: no room for another level\r\n");
+            continue;
+        }
+
+        FAT_File* fd = FAT_OpenEntry(disk, &entry);
+        if (fd == NULL)
+            continue;
+
+        uint64_t start = rdtsc();
+        uint32_t read = FAT_Read(disk, fd, entry.Size, next);
+        uint32_t cycles = (uint32_t)(rdtsc() - start);
+        FAT_Close(fd);
+
+        LEVELS_Entry* level = &directory->Levels[directory->Count++];
+        memcpy(level->Name, entry.Name, 11);
+        level->Name[11] = '\0';
+        level->Address = (uint32_t)next;
+        level->Size = read;
+        level->ReadCycles = cycles;
+
+        // the kernel uses the files in place, they stay 4 byte aligned
+        next += (read + 3) & ~3u;
+    }
+    FAT_Close(dir);
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include <stdint.h>
+#include "disk.h"
+
+// The level files of /levels on the disk, read into memory for the kernel,
+// which has no disk driver of its own. The directory sits at
+// MEMORY_LEVELS_ADDR, the files follow it. The kernel reads the same layout
+// in src/kernel/pacman/level_boot.h.
+
+#define LEVELS_MAGIC            0x5344564C  // "LVDS"
+#define LEVELS_MAX              16
+
+typedef struct
+{
+    char Name[12];              // the 8.3 name of the directory entry, NUL terminated
+    uint32_t Address;
+    uint32_t Size;
+    uint32_t ReadCycles;        // the time FAT_Read() took for the file
+} LEVELS_Entry;
+
+typedef struct
+{
+    uint32_t Magic;
+    uint32_t Count;
+    LEVELS_Entry Levels[LEVELS_MAX];
+} LEVELS_Directory;
+
+void LEVELS_Load(DISK* disk);
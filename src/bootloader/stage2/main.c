@@ -5,6 +5,7 @@
 #include "fat.h"
 #include "memdefs.h"
 #include "memory.h"
+#include "levels.h"
 
 uint8_t* KernelLoadBuffer = (uint8_t*)MEMORY_LOAD_KERNEL;
 uint8_t* Kernel = (uint8_t*)MEMORY_KERNEL_ADDR;
@@ -39,6 +40,9 @@ void __attribute__((cdecl)) start(uint16_t bootDrive)
     }
     FAT_Close(fd);
 
+    // the levels are read here too, the kernel can't read the disk
+    LEVELS_Load(&disk);
+
     // execute kernel
     KernelStart kernelStart = (KernelStart)Kernel;
     kernelStart();
@@ -15,7 +15,9 @@
 
 // 0x00020000 - 0x00030000 - stage2
 
-// 0x00030000 - 0x00080000 - free
+// 0x00040000 - 0x00080000 - the level files, for the kernel (see levels.h)
+#define MEMORY_LEVELS_ADDR  ((void*)0x40000)
+#define MEMORY_LEVELS_SIZE  0x00040000
 
 // 0x00080000 - 0x0009FFFF - Extended BIOS data area
 // 0x000A0000 - 0x000C7FFF - Video
@@ -0,0 +1,510 @@
+#define _POSIX_C_SOURCE 200112L
+#include "batch.h"
+#include <pacman/game.h>
+#include <pacman/maze.h>
+#include <pacman/level.h>
+#include <pacman/level_file.h>
+#include <pacman/pellets.h>
+#include <pacman/ghosts.h>
+#include <random.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define WALKABLE                LEVEL_WALKABLE
+#define PELLET_WORDS            ((WALKABLE + 31) / 32)
+#define HOP_WORDS               ((WALKABLE + 15) / 16)
+#define SLICE_GAMES             16      // the games of a field in a cache line
+#define THREAD_GAMES            1024    // fewer aren't worth waking a thread for
+#define BACK_EXITS              (MAZE_EXIT(down) + 1)   // a back exit is none or one of them
+
+// The parts of a ghost's script
+enum { PHASE_SCATTER, PHASE_CHASE, PHASE_RETURN };
+
+// The level over its walkable cells, in the order of g_LevelWalkableIndex.
+// Everything a step looks up is a 32-bit word, for the gathers.
+static int32_t g_Next[(GAME_MOVE_NONE + 1) * WALKABLE]; // the move of each Direction, the last one stays
+static int32_t g_Exits[WALKABLE];
+static int32_t g_Corridor[WALKABLE];                    // 1 off the junctions, the ghosts just go on
+static int32_t g_Power[WALKABLE];                       // 1 where the level has a power pellet
+static int32_t g_Component[WALKABLE];
+static uint16_t g_Cell[WALKABLE];                       // in the level's rows
+static uint32_t g_Hop[WALKABLE * HOP_WORDS];             // g_LevelNextHop with 16 pairs to a word
+static int32_t g_Steer[(4 + BATCH_MAX_GHOSTS) * WALKABLE * BACK_EXITS];   // Steer() to the corners, then to each spawn point
+static int32_t g_ExitCount32[16];
+static int32_t g_ExitDirection32[16 * 4];
+static uint32_t g_LevelPellets[PELLET_WORDS];
+static int32_t g_PelletCount;
+static int32_t g_PacmanSpawn;
+static int32_t g_GhostSpawns[BATCH_MAX_GHOSTS];         // the level's, then the spread ones of the batch
+static int g_GhostSpawnCount;                           // the level's
+
+// The games, a field over all of them at a time, padded to whole slices
+typedef struct {
+    int32_t* Pacman;
+    int32_t* Start;         // pacman's cell before the tick
+    int32_t* Score;
+    int32_t* Lives;
+    int32_t* PowerTicks;
+    int32_t* GraceTicks;
+    int32_t* Remaining;
+    int32_t* Caught;
+    RandomState* Random;    // random.c's generator, what Random_Below() in ghosts.c draws from
+    int32_t* Ghost[BATCH_MAX_GHOSTS];
+    int32_t* Back[BATCH_MAX_GHOSTS];    // the exit the ghost came in by, 0 on its spawn point
+    int32_t* Phase[BATCH_MAX_GHOSTS];   // the part of its script the ghost is in
+    int32_t* Ticks[BATCH_MAX_GHOSTS];   // the moves it made in that part
+    uint32_t* Pellets;      // PELLET_WORDS a game
+} BatchGames;
+
+static BatchGames g_Batch;
+static void* g_Memory;
+static int g_Games;
+static int g_Ghosts;
+static int g_Threads;
+
+static pthread_t g_Workers[BATCH_MAX_THREADS];
+static pthread_barrier_t g_Begin;
+static pthread_barrier_t g_End;
+static bool g_Quit;
+
+// The arguments of the step under way, for the workers
+static const uint8_t* g_Moves;
+static int32_t* g_Rewards;
+static uint8_t* g_Dones;
+static uint16_t* g_Observations;
+
+// Steer() of ghosts.c: never back, and the exit nearest to x, y as the
+// crow flies, the first of equals. GAME_MOVE_NONE without an exit.
+static int32_t Steer(int32_t cell, int32_t back, int32_t x, int32_t y)
+{
+    int32_t exits = g_Exits[cell], forward = exits & ~back;
+    int32_t best = GAME_MOVE_NONE, bestDistance = INT32_MAX;
+
+    exits = forward != 0 ? forward : exits;
+    for (int32_t d = left; d <= down; d++) {
+        int32_t next = g_Next[d * WALKABLE + cell];
+        int32_t dx = g_Cell[next] % LEVEL_COLS - x, dy = g_Cell[next] / LEVEL_COLS - y;
+        if ((exits >> d & 1) && dx * dx + dy * dy < bestDistance) {
+            best = d;
+            bestDistance = dx * dx + dy * dy;
+        }
+    }
+    return best;
+}
+
+
+// g_Steer to x, y from every cell and back exit
+static void BuildSteering(int target, int x, int y)
+{
+    for (int w = 0; w < WALKABLE; w++)
+        for (int back = 0; back < BACK_EXITS; back++)
+            g_Steer[(target * WALKABLE + w) * BACK_EXITS + back] = Steer(w, back, x, y);
+}
+
+static bool Near(int32_t w, int32_t away, int radius)
+{
+    int dx = g_Cell[w] % LEVEL_COLS - g_Cell[away] % LEVEL_COLS, dy = g_Cell[w] / LEVEL_COLS - g_Cell[away] / LEVEL_COLS;
+    return abs(dx) + abs(dy) < radius;
+}
+
+// The ghosts the level has no spawn points for, from first on, where
+// Actors_Spread() puts them: count cells at even steps over the walkable
+// ones at least radius from pacman's spawn point, in the level's rows
+static void SpreadGhosts(int first, int count, int radius)
+{
+    int walkable = 0, k = 0;
+
+    for (int w = 0; w < WALKABLE; w++)
+        walkable += !Near(w, g_PacmanSpawn, radius);
+    if (walkable == 0 && radius > 0) {
+        SpreadGhosts(first, count, 0);
+        return;
+    }
+    for (int w = 0; w < WALKABLE && walkable != 0; w++) {
+        if (Near(w, g_PacmanSpawn, radius))
+            continue;
+        if ((k + 1) * count / walkable != k * count / walkable)
+            g_GhostSpawns[first++] = w;
+        k++;
+    }
+}
+
+static void BuildTables()
+{
+    memset(g_Hop, 0, sizeof(g_Hop));
+    memset(g_LevelPellets, 0, sizeof(g_LevelPellets));
+    g_PelletCount = 0;
+    g_GhostSpawnCount = 0;
+
+    // in the order of the landscape, like the engine spawns its ghosts
+    for (int y = 0; y < LEVEL_ROWS; y++) {
+        for (int x = 0; x < LEVEL_COLS; x++) {
+            int w = g_LevelWalkableIndex[y * LEVEL_COLS + x];
+            if (w == LEVEL_NOT_WALKABLE)
+                continue;
+
+            uint8_t tile = g_LevelLandscape[y][x];
+            g_Cell[w] = y * LEVEL_COLS + x;
+            g_Power[w] = tile == TILE_POWER;
+            g_Component[w] = g_LevelComponent[w];
+            g_Corridor[w] = g_LevelCellJunction[y * LEVEL_COLS + x] == LEVEL_NO_JUNCTION;
+            if (tile == TILE_DOT || tile == TILE_POWER) {
+                g_LevelPellets[w >> 5] |= 1u << (w & 31);
+                g_PelletCount++;
+            }
+            if (tile == LEVEL_SPAWN_PACMAN)
+                g_PacmanSpawn = w;
+            else if (tile >= LEVEL_SPAWN_GHOST && tile < LEVEL_SPAWN_GHOST + LEVEL_SPAWN_GHOST_KINDS
+                && g_GhostSpawnCount < BATCH_MAX_GHOSTS)
+                g_GhostSpawns[g_GhostSpawnCount++] = w;
+
+            // the same edges as maze.c: the sides wrap around, the top and the bottom don't
+            g_Exits[w] = 0;
+            for (int d = left; d <= down; d++) {
+                int nx = x, ny = y;
+                switch (d) {
+                case left:  nx = (x + LEVEL_COLS - 1) % LEVEL_COLS; break;
+                case right: nx = (x + 1) % LEVEL_COLS; break;
+                case up:    ny--; break;
+                case down:  ny++; break;
+                }
+                int next = ny >= 0 && ny < LEVEL_ROWS ? g_LevelWalkableIndex[ny * LEVEL_COLS + nx] : LEVEL_NOT_WALKABLE;
+                g_Next[d * WALKABLE + w] = next != LEVEL_NOT_WALKABLE ? next : w;
+                if (next != LEVEL_NOT_WALKABLE)
+                    g_Exits[w] |= MAZE_EXIT(d);
+            }
+            g_Next[GAME_MOVE_NONE * WALKABLE + w] = w;
+        }
+    }
+
+    for (int a = 0; a < WALKABLE; a++) {
+        for (int b = 0; b < WALKABLE; b++) {
+            uint32_t hop = (g_LevelNextHop[a][b >> 2] >> (2 * (b & 3))) & 3;
+            g_Hop[a * HOP_WORDS + (b >> 4)] |= hop << (2 * (b & 15));
+        }
+    }
+    // the corners of Scatter() in ghosts.c, the whole level is awake
+    for (int corner = 0; corner < 4; corner++)
+        BuildSteering(corner, corner & 1 ? 0 : LEVEL_COLS - 1, corner & 2 ? LEVEL_ROWS - 1 : 0);
+    for (int exits = 0; exits < 16; exits++) {
+        g_ExitCount32[exits] = g_ExitCount[exits];
+        for (int n = 0; n < 4; n++)
+            g_ExitDirection32[exits * 4 + n] = g_ExitDirection[exits][n];
+    }
+}
+
+// The actors back on their spawn points
+static void StartRound(int game)
+{
+    g_Batch.Pacman[game] = g_PacmanSpawn;
+    g_Batch.PowerTicks[game] = 0;
+    g_Batch.GraceTicks[game] = GAME_RESPAWN_TICKS;
+    for (int g = 0; g < g_Ghosts; g++) {
+        g_Batch.Ghost[g][game] = g_GhostSpawns[g];
+        g_Batch.Back[g][game] = 0;
+        g_Batch.Phase[g][game] = PHASE_SCATTER;
+        g_Batch.Ticks[g][game] = 0;
+    }
+}
+
+static void StartLevel(int game)
+{
+    memcpy(&g_Batch.Pellets[game * PELLET_WORDS], g_LevelPellets, sizeof(g_LevelPellets));
+    g_Batch.Remaining[game] = g_PelletCount;
+    StartRound(game);
+}
+
+static void StartGame(int game)
+{
+    g_Batch.Score[game] = 0;
+    g_Batch.Lives[game] = GAME_LIVES;
+    StartLevel(game);
+}
+
+static void Observe(int game, uint16_t* observation)
+{
+    observation[BATCH_OBS_PACMAN] = g_Cell[g_Batch.Pacman[game]];
+    for (int g = 0; g < BATCH_MAX_GHOSTS; g++)
+        observation[BATCH_OBS_GHOSTS + g] = g < g_Ghosts ? g_Cell[g_Batch.Ghost[g][game]] : BATCH_OBS_NONE;
+    observation[BATCH_OBS_POWER] = g_Batch.PowerTicks[game];
+    observation[BATCH_OBS_LIVES] = g_Batch.Lives[game];
+    observation[BATCH_OBS_PELLETS] = g_Batch.Remaining[game];
+    observation[BATCH_OBS_GRACE] = g_Batch.GraceTicks[game];
+}
+
+// Pacman's move and the pellet on the cell he got to. The loops below take
+// their fields as restrict arguments, they only vectorize when the compiler
+// knows the gathers from the tables can't see the stores.
+static void MovePacman(int count, const uint8_t* restrict moves, int32_t* restrict pacman, int32_t* restrict start,
+    int32_t* restrict rewards, int32_t* restrict powerTicks, int32_t* restrict graceTicks, int32_t* restrict remaining,
+    int32_t* restrict caught, uint32_t* restrict pellets)
+{
+    for (int i = 0; i < count; i++) {
+        int32_t move = moves[i] < GAME_MOVE_NONE ? moves[i] : GAME_MOVE_NONE;
+        int32_t from = pacman[i], to = g_Next[move * WALKABLE + from];
+        int32_t eaten = (pellets[i * PELLET_WORDS + (to >> 5)] >> (to & 31)) & 1;
+        int32_t power = eaten & g_Power[to];
+
+        start[i] = from;
+        pacman[i] = to;
+        rewards[i] = eaten * PELLET_DOT_SCORE + power * (PELLET_POWER_SCORE - PELLET_DOT_SCORE);
+        powerTicks[i] = power ? GAME_POWER_TICKS : powerTicks[i];
+        remaining[i] -= eaten;
+        graceTicks[i] -= graceTicks[i] > 0;
+        caught[i] = 0;
+    }
+
+    // clearing a bit that isn't set changes nothing, the stores are scattered anyway
+    for (int i = 0; i < count; i++)
+        pellets[i * PELLET_WORDS + (pacman[i] >> 5)] &= ~(1u << (pacman[i] & 31));
+}
+
+// One ghost of every game, a step of its script, then what it ran into.
+// A part of the script ends where RunScript() in ghosts.c ends it: after
+// its moves, the return home early once the ghost is there, and an eaten
+// ghost starts over. Scattering and returning home look up g_Steer,
+// chasing goes on through the corridors and takes the next hop to pacman
+// at a junction. The parts are picked with selects, the games of a slice
+// are in different ones.
+static void MoveGhost(int count, int g, int32_t* restrict ghost, int32_t* restrict back, int32_t* restrict phase,
+    int32_t* restrict ticks, const int32_t* restrict pacman, const int32_t* restrict start,
+    const int32_t* restrict powerTicks, const int32_t* restrict graceTicks, RandomState* restrict random,
+    int32_t* restrict rewards, int32_t* restrict caught)
+{
+    int32_t spawn = g_GhostSpawns[g], scatter = (g & 3) * WALKABLE, home = (4 + g) * WALKABLE;
+
+    for (int i = 0; i < count; i++) {
+        int32_t cell = ghost[i], target = pacman[i];
+        int32_t exits = g_Exits[cell];
+        int32_t forward = exits & ~back[i];
+        int32_t p = phase[i], t = ticks[i];
+
+        // in order, a chase that ends on the spawn point has nothing to return
+        int32_t toChase = p == PHASE_SCATTER && t == GHOST_SCATTER_TICKS;
+        p = toChase ? PHASE_CHASE : p;
+        t = toChase ? 0 : t;
+        int32_t toReturn = p == PHASE_CHASE && t == GHOST_CHASE_TICKS;
+        p = toReturn ? PHASE_RETURN : p;
+        t = toReturn ? 0 : t;
+        int32_t toScatter = p == PHASE_RETURN && (t == GHOST_RETURN_TICKS || cell == spawn);
+        p = toScatter ? PHASE_SCATTER : p;
+        t = toScatter ? 0 : t;
+
+        // scatter and return home steer, to the corner or the spawn point
+        int32_t steer = g_Steer[((p == PHASE_RETURN ? home : scatter) + cell) * BACK_EXITS + back[i]];
+
+        int32_t corridor = g_Corridor[cell] & (forward != 0);
+        int32_t hop = (g_Hop[cell * HOP_WORDS + (target >> 4)] >> (2 * (target & 15))) & 3;
+        int32_t best = g_Component[cell] == g_Component[target] ? 1 << hop : exits;
+
+        // a chase off the corridors draws once where Chase() in ghosts.c does, a single exit too
+        int32_t draw = (p == PHASE_CHASE) & !corridor & (best != 0);
+        int32_t n = draw ? Random_BelowState(&random[i], g_ExitCount32[best]) : 0;
+        int32_t keep = -corridor;
+        int32_t chased = best != 0 ? g_ExitDirection32[(forward * 4 & keep) | ((best * 4 + n) & ~keep)] : GAME_MOVE_NONE;
+
+        int32_t direction = p == PHASE_CHASE ? chased : steer;
+        int32_t to = g_Next[direction * WALKABLE + cell];
+        int32_t hit = (to == target) | ((to == start[i]) & (cell == target) & (start[i] != target));
+        int32_t eaten = hit & (powerTicks[i] > 0);
+        ghost[i] = eaten ? spawn : to;
+        back[i] = eaten ? 0 : to != cell ? 1 << (direction ^ 1) : back[i];
+        phase[i] = eaten ? PHASE_SCATTER : p;
+        ticks[i] = eaten ? 0 : t + 1;
+        rewards[i] += eaten * GAME_GHOST_SCORE;
+        caught[i] |= hit & (powerTicks[i] <= 0) & (graceTicks[i] <= 0);
+    }
+}
+
+// The points, the lives and the power pellet. The games that lost pacman
+// or cleared the maze stay flagged in caught, to be started over.
+static void Settle(int count, const int32_t* restrict rewards, const int32_t* restrict remaining,
+    int32_t* restrict score, int32_t* restrict lives, int32_t* restrict powerTicks, int32_t* restrict caught,
+    uint8_t* restrict dones)
+{
+    for (int i = 0; i < count; i++) {
+        int32_t hit = caught[i];
+        score[i] += rewards[i];
+        lives[i] -= hit;
+        dones[i] = hit & (lives[i] == 0);
+        powerTicks[i] = hit ? 0 : powerTicks[i] - (powerTicks[i] > 0);
+        caught[i] = hit | (remaining[i] == 0);
+    }
+}
+
+// The tick of game.c over the games from begin to end
+static void StepSlice(int begin, int end)
+{
+    int32_t* rewards = g_Rewards;
+    int32_t* powerTicks = g_Batch.PowerTicks;
+
+    MovePacman(end - begin, &g_Moves[begin], &g_Batch.Pacman[begin], &g_Batch.Start[begin], &rewards[begin],
+        &powerTicks[begin], &g_Batch.GraceTicks[begin], &g_Batch.Remaining[begin], &g_Batch.Caught[begin],
+        &g_Batch.Pellets[begin * PELLET_WORDS]);
+    for (int g = 0; g < g_Ghosts; g++)
+        MoveGhost(end - begin, g, &g_Batch.Ghost[g][begin], &g_Batch.Back[g][begin], &g_Batch.Phase[g][begin],
+            &g_Batch.Ticks[g][begin], &g_Batch.Pacman[begin], &g_Batch.Start[begin], &powerTicks[begin], &g_Batch.GraceTicks[begin],
+            &g_Batch.Random[begin], &rewards[begin], &g_Batch.Caught[begin]);
+
+    Settle(end - begin, &rewards[begin], &g_Batch.Remaining[begin], &g_Batch.Score[begin], &g_Batch.Lives[begin],
+        &powerTicks[begin], &g_Batch.Caught[begin], &g_Dones[begin]);
+
+    // what's left is rare and branchy
+    for (int i = begin; i < end; i++) {
+        if (!g_Batch.Caught[i])
+            continue;
+        if (g_Dones[i])
+            StartGame(i);
+        else if (g_Batch.Remaining[i] == 0)
+            StartLevel(i);
+        else
+            StartRound(i);
+    }
+
+    for (int i = begin; i < end; i++)
+        Observe(i, &g_Observations[i * BATCH_OBS_SIZE]);
+}
+
+static void StepThread(int thread)
+{
+    int slices = (g_Games + SLICE_GAMES - 1) / SLICE_GAMES;
+    int begin = slices * thread / g_Threads * SLICE_GAMES;
+    int end = slices * (thread + 1) / g_Threads * SLICE_GAMES;
+    StepSlice(begin, end < g_Games ? end : g_Games);
+}
+
+static void* Worker(void* arg)
+{
+    int thread = (int)(intptr_t)arg;
+
+    for (;;) {
+        pthread_barrier_wait(&g_Begin);
+        if (g_Quit)
+            return NULL;
+        StepThread(thread);
+        pthread_barrier_wait(&g_End);
+    }
+}
+
+// One block for all the fields, each on a cache line of its own
+static bool Allocate()
+{
+    size_t padded = (g_Games + SLICE_GAMES - 1) / SLICE_GAMES * SLICE_GAMES;
+    size_t field = padded * sizeof(int32_t);
+    size_t size = field * (12 + 4 * BATCH_MAX_GHOSTS) + padded * PELLET_WORDS * sizeof(uint32_t);
+
+    if (posix_memalign(&g_Memory, 64, size) != 0)
+        return false;
+    memset(g_Memory, 0, size);
+
+    uint8_t* p = g_Memory;
+    g_Batch.Pacman = (int32_t*)p;       p += field;
+    g_Batch.Start = (int32_t*)p;        p += field;
+    g_Batch.Score = (int32_t*)p;        p += field;
+    g_Batch.Lives = (int32_t*)p;        p += field;
+    g_Batch.PowerTicks = (int32_t*)p;   p += field;
+    g_Batch.GraceTicks = (int32_t*)p;   p += field;
+    g_Batch.Remaining = (int32_t*)p;    p += field;
+    g_Batch.Caught = (int32_t*)p;       p += field;
+    g_Batch.Random = (RandomState*)p;   p += 4 * field;     // four words a game
+    for (int g = 0; g < BATCH_MAX_GHOSTS; g++) {
+        g_Batch.Ghost[g] = (int32_t*)p; p += field;
+        g_Batch.Back[g] = (int32_t*)p;  p += field;
+        g_Batch.Phase[g] = (int32_t*)p; p += field;
+        g_Batch.Ticks[g] = (int32_t*)p; p += field;
+    }
+    g_Batch.Pellets = (uint32_t*)p;
+    return true;
+}
+
+bool Batch_Initialize(const BatchConfig* config)
+{
+    BuildTables();
+    if (config->Games <= 0 || config->Ghosts < 0 || config->Ghosts > BATCH_MAX_GHOSTS
+        || config->Threads <= 0 || config->Threads > BATCH_MAX_THREADS)
+        return false;
+
+    if (config->Ghosts > g_GhostSpawnCount)
+        SpreadGhosts(g_GhostSpawnCount, config->Ghosts - g_GhostSpawnCount, GAME_SPAWN_RADIUS);
+    for (int g = 0; g < config->Ghosts; g++)
+        BuildSteering(4 + g, g_Cell[g_GhostSpawns[g]] % LEVEL_COLS, g_Cell[g_GhostSpawns[g]] / LEVEL_COLS);
+
+    g_Games = config->Games;
+    g_Ghosts = config->Ghosts;
+    g_Threads = (g_Games + THREAD_GAMES - 1) / THREAD_GAMES;
+    if (g_Threads > config->Threads)
+        g_Threads = config->Threads;
+    if (!Allocate())
+        return false;
+
+    // the first game draws what the engine seeded with the same seed does
+    for (int i = 0; i < g_Games; i++) {
+        Random_SeedState(&g_Batch.Random[i], config->Seed + i);
+        StartGame(i);
+    }
+
+    g_Quit = false;
+    if (g_Threads > 1) {
+        pthread_barrier_init(&g_Begin, NULL, g_Threads);
+        pthread_barrier_init(&g_End, NULL, g_Threads);
+        for (int t = 1; t < g_Threads; t++)
+            pthread_create(&g_Workers[t], NULL, Worker, (void*)(intptr_t)t);
+    }
+    return true;
+}
+
+void Batch_Shutdown()
+{
+    if (g_Threads > 1) {
+        g_Quit = true;
+        pthread_barrier_wait(&g_Begin);
+        for (int t = 1; t < g_Threads; t++)
+            pthread_join(g_Workers[t], NULL);
+        pthread_barrier_destroy(&g_Begin);
+        pthread_barrier_destroy(&g_End);
+    }
+    free(g_Memory);
+    g_Memory = NULL;
+    g_Games = 0;
+}
+
+void Batch_Step(const uint8_t* moves, int32_t* rewards, uint8_t* dones, uint16_t* observations)
+{
+    g_Moves = moves;
+    g_Rewards = rewards;
+    g_Dones = dones;
+    g_Observations = observations;
+
+    if (g_Threads == 1) {
+        StepSlice(0, g_Games);
+        return;
+    }
+    pthread_barrier_wait(&g_Begin);
+    StepThread(0);
+    pthread_barrier_wait(&g_End);
+}
+
+const uint32_t* Batch_GetPellets(int game)
+{
+    return &g_Batch.Pellets[game * PELLET_WORDS];
+}
+
+uint32_t Batch_Hash()
+{
+    uint32_t hash = 2166136261u;
+
+    for (int i = 0; i < g_Games; i++) {
+        hash = (hash ^ g_Batch.Pacman[i]) * 16777619u;
+        for (int g = 0; g < g_Ghosts; g++)
+            hash = ((hash ^ g_Batch.Ghost[g][i]) * 16777619u ^ g_Batch.Phase[g][i]) * 16777619u;
+        hash = (hash ^ g_Batch.Score[i]) * 16777619u;
+        hash = (hash ^ g_Batch.Lives[i]) * 16777619u;
+        hash = (hash ^ g_Batch.PowerTicks[i]) * 16777619u;
+        hash = (hash ^ g_Batch.GraceTicks[i]) * 16777619u;
+        for (int w = 0; w < PELLET_WORDS; w++)
+            hash = (hash ^ g_Batch.Pellets[i * PELLET_WORDS + w]) * 16777619u;
+    }
+    return hash;
+}
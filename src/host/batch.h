@@ -0,0 +1,56 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+// Many independent games of the compiled level stepped together, for
+// evaluating and tuning players rather than playing. The engine keeps one
+// game in globals, so this is the tick of game.c over again for arrays of
+// games: pacman moves and eats, the ghosts run the scripts of ghosts.c,
+// out to their corners, after pacman with the level's next hop tables and
+// back home, the collisions, the power pellets, the lives and the levels
+// are the engine's. Every game draws from a stream of random.c of its own,
+// seeded with the batch's seed plus its number: the first game of a batch
+// is the engine's game on the same seed and moves, tick for tick, which
+// bench_batch checks before it times anything.
+//
+// The state is kept a field at a time over all the games, 32-bit indices
+// into small shared tables, so a step over a slice of games is a few loops
+// the compiler turns into SIMD gathers and selects. The games are split
+// over the threads in slices of whole cache lines.
+
+#define BATCH_MAX_GHOSTS        8   // the level's spawn points, the rest spread like Actors_Spread() does
+#define BATCH_MAX_THREADS       64
+
+// An observation, BATCH_OBS_SIZE values per game
+#define BATCH_OBS_PACMAN        0   // the cell, in the level's rows
+#define BATCH_OBS_GHOSTS        1   // BATCH_MAX_GHOSTS cells, BATCH_OBS_NONE for the missing
+#define BATCH_OBS_POWER         9   // ticks left of the power pellet
+#define BATCH_OBS_LIVES         10
+#define BATCH_OBS_PELLETS       11  // left in the maze
+#define BATCH_OBS_GRACE         12  // ticks left before the ghosts can catch pacman again
+#define BATCH_OBS_SIZE          13
+#define BATCH_OBS_NONE          0xFFFF
+
+typedef struct {
+    int Games;
+    int Ghosts;             // up to BATCH_MAX_GHOSTS
+    int Threads;            // at most, the caller's thread is the first one
+    uint32_t Seed;          // the same seed and moves give the same games
+} BatchConfig;
+
+// Starts every game, false if the configuration or the allocation failed
+bool Batch_Initialize(const BatchConfig* config);
+void Batch_Shutdown();
+
+// One tick of every game. Moves holds a Direction or GAME_MOVE_NONE per
+// game. Out come the points each game scored, whether it ended on the tick
+// and its observation. A game that ended starts over right away, its
+// observation is the new game's.
+void Batch_Step(const uint8_t* moves, int32_t* rewards, uint8_t* dones, uint16_t* observations);
+
+// The pellets of the game, a bit per walkable cell of the level in the
+// order of g_LevelWalkableIndex
+const uint32_t* Batch_GetPellets(int game);
+
+// A hash of every game, the same whatever the number of threads
+uint32_t Batch_Hash();
@@ -0,0 +1,258 @@
+// The batched games of batch.c against the engine: steps per second of one
+// Game_Step() game, then of batches of more and more games on one thread
+// and on all of them. Every batch row plays about the same number of game
+// steps. The moves are random arrows, a fifth of them none.
+//
+// First the first game of a batch and the engine play the same seed and
+// moves for CHECK_TICKS ticks and have to agree on every one of them, it
+// exits with 2 on the first tick they don't. The moves are the autopilot's,
+// random ones lose a life every few dozen ticks and the ghosts would never
+// get through their scripts, with a random arrow now and then so pacman
+// still gets caught. The level's ghosts stay in their house for the whole
+// respawn grace, the check has CHECK_GHOSTS and the spread ones can get to
+// pacman before it's over: while it lasts he runs at the nearest ghost, and
+// the check fails too if none ever reached him then.
+//
+// Usage: bench_batch [game steps per row] [threads] [seed]
+#define _POSIX_C_SOURCE 199309L
+#include "batch.h"
+#include "drivers.h"
+#include <pacman/game.h>
+#include <pacman/level.h>
+#include <pacman/autopilot.h>
+#include <pacman/distance.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+
+#define DEFAULT_STEPS           8000000
+#define ENGINE_SHARE            64      // the engine row plays this much less
+#define DEFAULT_SEED            1
+#define GHOSTS                  4
+#define MOVE_POOL               4096    // the moves of a step start somewhere in the pool
+#define CHECK_TICKS             20000
+#define CHECK_GHOSTS            8       // with some spread over the maze, near enough to pacman to test the grace
+#define CHECK_STRAY             32      // one move in this many is a random one instead
+
+static uint64_t Now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static uint32_t NextMove(uint32_t* r)
+{
+    *r ^= *r << 13;
+    *r ^= *r >> 17;
+    *r ^= *r << 5;
+    return *r % (GAME_MOVE_NONE + 1);
+}
+
+// A cell of the engine's maze in the level's rows, like the observations
+static uint16_t LevelCell(uint16_t cell)
+{
+    return MAZE_Y(cell) * LEVEL_COLS + MAZE_X(cell);
+}
+
+static bool Agree(uint32_t tick, const char* what, uint32_t engine, uint32_t batch)
+{
+    if (engine != batch)
+        fprintf(stderr, "bench_batch: tick %u, %s %u in the engine, %u in the batch\n", tick, what, engine, batch);
+    return engine == batch;
+}
+
+// The arrow the autopilot pressed on the engine's game, GAME_MOVE_NONE if none
+static uint8_t AutopilotMove(const InputDriver* autopilot)
+{
+    InputEvent event;
+    uint8_t move = GAME_MOVE_NONE;
+
+    autopilot->Poll(Game_GetTick());
+    while (Input_Pop(&event))
+        if (!event.Released && event.Key != INPUT_KEY_OTHER && move == GAME_MOVE_NONE)
+            move = event.Key;
+    return move;
+}
+
+// The way to the ghost pacman gets to first, GAME_MOVE_NONE if none
+static uint8_t TowardGhost()
+{
+    static DistanceField field;
+    uint16_t pacman = g_Actors.Cell[ACTOR_PACMAN];
+    uint8_t move = GAME_MOVE_NONE;
+    uint16_t nearest = DISTANCE_UNREACHABLE;
+
+    Distance_FromCell(&field, pacman);
+    for (int i = ACTOR_FIRST_GHOST; i < g_Actors.Count; i++) {
+        uint16_t ghost = g_Actors.Cell[i];
+        if (ghost != pacman && field.Distance[ghost] < nearest) {
+            move = Level_NextHop(pacman, ghost);
+            nearest = field.Distance[ghost];
+        }
+    }
+    return move;
+}
+
+// A ghost on pacman's cell or one he swapped cells with, that the grace
+// kept from catching him
+static bool Spared(const GameState* state)
+{
+    uint16_t pacman = g_Actors.Cell[ACTOR_PACMAN], start = g_Actors.Prev[ACTOR_PACMAN];
+
+    if (state->GraceTicks == 0 || state->PowerTicks > 0)
+        return false;
+    for (int i = ACTOR_FIRST_GHOST; i < g_Actors.Count; i++)
+        if (g_Actors.Cell[i] == pacman || (g_Actors.Cell[i] == start && g_Actors.Prev[i] == pacman && start != pacman))
+            return true;
+    return false;
+}
+
+// One batched game next to Game_UpdateMoves(): pacman, the ghosts, the
+// score, the lives, the power pellet, the grace and the pellets left after
+// every tick
+static bool Check(uint32_t ticks, uint32_t seed)
+{
+    BatchConfig batch = { .Games = 1, .Ghosts = CHECK_GHOSTS, .Threads = 1, .Seed = seed };
+    GameConfig config = {
+        .Render = RenderNull_GetDriver(),
+        .Input = Autopilot_GetDriver(),
+        .WaitRetrace = false,
+        .Seed = seed,
+        .Ghosts = CHECK_GHOSTS,
+    };
+    static GameState state;
+    uint16_t observation[BATCH_OBS_SIZE];
+    int32_t reward;
+    uint8_t done;
+    uint32_t r = seed | 1, score = 0, games = 0, spared = 0;
+    bool same = true;
+
+    if (!Batch_Initialize(&batch)) {
+        fprintf(stderr, "bench_batch: can't start a game\n");
+        exit(1);
+    }
+    Game_Initialize(&config);
+    Game_SaveState(&state);
+
+    for (uint32_t tick = 0; tick < ticks && same; tick++) {
+        uint8_t move = AutopilotMove(config.Input), stray = NextMove(&r);
+        if (r / (GAME_MOVE_NONE + 1) % CHECK_STRAY == 0)
+            move = stray;
+        if (state.GraceTicks > 0)
+            move = TowardGhost();
+        GameMoves moves = { .Pacman = move, .Ghost = GAME_MOVE_NONE };
+
+        Game_UpdateMoves(&moves);
+        Batch_Step(&move, &reward, &done, observation);
+        score = done ? 0 : score + reward;
+        games += done;
+        Game_SaveState(&state);
+        spared += Spared(&state);
+
+        same = Agree(tick, "pacman's cell", LevelCell(g_Actors.Cell[ACTOR_PACMAN]), observation[BATCH_OBS_PACMAN]);
+        for (int g = 0; g < CHECK_GHOSTS && same; g++)
+            same = Agree(tick, "a ghost's cell", LevelCell(g_Actors.Cell[ACTOR_FIRST_GHOST + g]),
+                observation[BATCH_OBS_GHOSTS + g]);
+        same = same && Agree(tick, "the score", Game_GetScore(), score)
+            && Agree(tick, "the games", Game_GetGames(), games)
+            && Agree(tick, "the lives", Game_GetLives(), observation[BATCH_OBS_LIVES])
+            && Agree(tick, "the power ticks", state.PowerTicks, observation[BATCH_OBS_POWER])
+            && Agree(tick, "the grace ticks", state.GraceTicks, observation[BATCH_OBS_GRACE])
+            && Agree(tick, "the pellets", state.Pellets.Remaining, observation[BATCH_OBS_PELLETS]);
+    }
+    if (same && spared == 0) {
+        fprintf(stderr, "bench_batch: no ghost reached pacman during the grace, it wasn't checked\n");
+        same = false;
+    }
+    if (same)
+        printf("the engine and the batch agree for %u ticks, %u games, score %u, %u catches spared\n",
+            ticks, games, score, spared);
+    Batch_Shutdown();
+    return same;
+}
+
+static void Engine(uint32_t steps, uint32_t seed)
+{
+    GameConfig config = {
+        .Render = RenderNull_GetDriver(),
+        .Input = InputScript_GetDriver(),
+        .WaitRetrace = false,
+        .Seed = seed,
+        .Ghosts = GHOSTS,
+    };
+
+    InputScript_Seed(seed);
+    Game_Initialize(&config);
+    uint64_t start = Now();
+    for (uint32_t i = 0; i < steps; i++)
+        Game_Step();
+    uint64_t elapsed = Now() - start;
+
+    printf("%-7s %7d %7u %14.0f %9.1f %10s %8u   %08x\n", "engine", 1, 1, steps * 1e9 / elapsed,
+        (double)elapsed / steps, "-", Game_GetGames(), Game_StateHash());
+}
+
+static void Run(int games, int threads, uint32_t total, uint32_t seed)
+{
+    BatchConfig config = { .Games = games, .Ghosts = GHOSTS, .Threads = threads, .Seed = seed };
+    uint8_t* moves = malloc(games + MOVE_POOL);
+    int32_t* rewards = malloc(games * sizeof(int32_t));
+    uint8_t* dones = malloc(games);
+    uint16_t* observations = malloc(games * BATCH_OBS_SIZE * sizeof(uint16_t));
+    uint32_t steps = total / games > 0 ? total / games : 1, r = seed | 1, ended = 0;
+    uint64_t points = 0;
+
+    if (moves == NULL || rewards == NULL || dones == NULL || observations == NULL || !Batch_Initialize(&config)) {
+        fprintf(stderr, "bench_batch: can't start %d games\n", games);
+        exit(1);
+    }
+    for (int i = 0; i < games + MOVE_POOL; i++)
+        moves[i] = NextMove(&r);
+
+    uint64_t start = Now();
+    for (uint32_t step = 0; step < steps; step++) {
+        Batch_Step(&moves[(step * 997) % MOVE_POOL], rewards, dones, observations);
+        for (int i = 0; i < games; i++) {
+            points += rewards[i];
+            ended += dones[i];
+        }
+    }
+    uint64_t elapsed = Now() - start;
+    double played = (double)steps * games;
+
+    printf("%-7s %7d %7d %14.0f %9.1f %10.2f %8u   %08x\n", "batch", games, threads, played * 1e9 / elapsed,
+        elapsed / played, points / played, ended, Batch_Hash());
+    Batch_Shutdown();
+    free(moves);
+    free(rewards);
+    free(dones);
+    free(observations);
+}
+
+int main(int argc, char** argv)
+{
+    static const int sizes[] = { 1, 16, 256, 4096, 65536 };
+    uint32_t steps = argc > 1 ? strtoul(argv[1], NULL, 0) : DEFAULT_STEPS;
+    int threads = argc > 2 ? atoi(argv[2]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+    uint32_t seed = argc > 3 ? strtoul(argv[3], NULL, 0) : DEFAULT_SEED;
+
+    if (steps == 0 || threads <= 0 || threads > BATCH_MAX_THREADS) {
+        fprintf(stderr, "Usage: bench_batch [game steps per row] [threads] [seed]\n");
+        return 1;
+    }
+
+    printf("%u game steps per row, %d ghosts, seed %u\n", steps, GHOSTS, seed);
+    if (!Check(CHECK_TICKS, seed))
+        return 2;
+    printf("        games threads      steps/sec   ns/step pts/step    ended   hash\n");
+    Engine(steps / ENGINE_SHARE, seed);
+    for (int s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        Run(sizes[s], 1, steps, seed);
+        if (threads > 1)
+            Run(sizes[s], threads, steps, seed);
+    }
+    return 0;
+}
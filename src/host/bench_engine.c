@@ -0,0 +1,107 @@
+// The pacman simulation as a Linux program: no VGA, no IRQs, a scripted
+// keyboard and a fixed seed, so the numbers only depend on the engine.
+// With "autopilot" pacman plays for real instead of pressing random arrows,
+// with "generated" on mazes made up from the seed instead of the compiled level.
+//
+// Usage: bench_engine [ticks] [seed] [script|autopilot] [compiled|generated]
+#define _POSIX_C_SOURCE 199309L
+#include "drivers.h"
+#include <pacman/game.h>
+#include <pacman/actors.h>
+#include <pacman/collision.h>
+#include <pacman/autopilot.h>
+#include <pacman/entity.h>
+#include <pacman/arena.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#define DEFAULT_TICKS           200000
+#define DEFAULT_SEED            1
+#define WARMUP_TICKS            1000
+
+static uint64_t Now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+// The same seed has to end in the same positions on every run
+static uint32_t Checksum()
+{
+    uint32_t hash = 2166136261u;
+    for (int i = 0; i < g_Actors.Count; i++)
+        hash = (hash ^ g_Actors.Cell[i]) * 16777619u;
+    return hash;
+}
+
+static void Run(const InputDriver* input, int ghosts, uint32_t ticks, uint32_t seed, bool generate)
+{
+    GameConfig config = {
+        .Render = RenderNull_GetDriver(),
+        .Input = input,
+        .WaitRetrace = false,
+        .Seed = seed,
+        .Ghosts = ghosts,
+        .Generate = generate,
+    };
+
+    InputScript_Seed(seed);
+    Game_Initialize(&config);
+    for (uint32_t i = 0; i < WARMUP_TICKS; i++)
+        Game_Step();
+
+    uint32_t cells = RenderNull_GetCells();
+    CollisionStats collisions = *Collision_GetStats();
+    uint64_t start = Now();
+    for (uint32_t i = 0; i < ticks; i++)
+        Game_Step();
+    uint64_t elapsed = Now() - start;
+    cells = RenderNull_GetCells() - cells;
+    uint32_t hits = Collision_GetStats()->SameCell - collisions.SameCell + Collision_GetStats()->Swaps - collisions.Swaps;
+
+    printf("%6d %14.0f %10.1f %12.1f %8u %7u %6u %10u   %08x\n", g_Actors.Count - ACTOR_FIRST_GHOST,
+        ticks * 1e9 / elapsed, (double)elapsed / ticks, (double)cells / ticks,
+        Game_GetScore(), Game_GetLevel(), Game_GetGames(), hits, Checksum());
+}
+
+int main(int argc, char** argv)
+{
+    static const int counts[] = { 1, 4, 16, 64, ACTOR_MAX_GHOSTS };
+    uint32_t ticks = argc > 1 ? strtoul(argv[1], NULL, 0) : DEFAULT_TICKS;
+    uint32_t seed = argc > 2 ? strtoul(argv[2], NULL, 0) : DEFAULT_SEED;
+    const InputDriver* input = InputScript_GetDriver();
+    bool generate = GAME_GENERATE;
+
+    if (argc > 3 && strcmp(argv[3], "autopilot") == 0)
+        input = Autopilot_GetDriver();
+    else if (argc > 3 && strcmp(argv[3], "script") != 0)
+        ticks = 0;
+    if (argc > 4 && strcmp(argv[4], "generated") == 0)
+        generate = true;
+    else if (argc > 4 && strcmp(argv[4], "compiled") == 0)
+        generate = false;
+    else if (argc > 4)
+        ticks = 0;
+
+    if (ticks == 0) {
+        fprintf(stderr, "Usage: bench_engine [ticks] [seed] [script|autopilot] [compiled|generated]\n");
+        return 1;
+    }
+
+    printf("%u ticks per run, seed %u, %s input, %s mazes\n", ticks, seed, input->Name,
+        generate ? "generated" : "compiled");
+    printf("ghosts      ticks/sec    ns/tick  cells/frame    score  levels  games collisions   checksum\n");
+    for (int c = 0; c < sizeof(counts) / sizeof(counts[0]); c++) {
+        if (c > 0 && counts[c] == counts[c - 1])
+            continue;
+        Run(input, counts[c], ticks, seed, generate);
+    }
+    printf("high water over the runs: %u/%u entities, %u/%u arena bytes, %u failed allocations\n",
+        Entity_GetStats()->HighWater, ENTITY_MAX, Arena_GetStats()->HighWater, ARENA_SIZE,
+        Entity_GetStats()->Full + Arena_GetStats()->Failed);
+    return 0;
+}
@@ -0,0 +1,101 @@
+// The maze generator as a Linux program: makes mazes from consecutive seeds
+// as fast as it can, checks every one and reports their averages. With
+// "print" it prints the maze of the seed in the characters of levels/*.txt
+// instead, ready to be edited into a level of its own.
+//
+// Usage: bench_mazegen [mazes] [seed]
+//        bench_mazegen print [seed]
+#define _POSIX_C_SOURCE 199309L
+#include <pacman/maze_gen.h>
+#include <pacman/maze.h>
+#include <pacman/level_file.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#define DEFAULT_MAZES           100000
+#define DEFAULT_SEED            1
+
+static uint8_t g_Landscape[NUM_ROWS * NUM_COLS];
+
+static uint64_t Now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+// The same seeds have to make the same mazes on every run
+static uint32_t Checksum(uint32_t hash)
+{
+    for (int i = 0; i < NUM_ROWS * NUM_COLS; i++)
+        hash = (hash ^ g_Landscape[i]) * 16777619u;
+    return hash;
+}
+
+static int Print(uint32_t seed)
+{
+    // the tiles, the ghosts 5..8 and pacman, the way build_scripts/level_compiler.c reads them
+    static const char chars[] = " #.*-5678C";
+    MazeGenStats stats;
+
+    if (!MazeGen_Generate(seed, g_Landscape, &stats)) {
+        fprintf(stderr, "bench_mazegen: nothing usable from seed %u\n", seed);
+        return 1;
+    }
+    for (int y = 0; y < NUM_ROWS; y++) {
+        for (int x = 0; x < NUM_COLS; x++)
+            putchar(chars[g_Landscape[y * NUM_COLS + x]]);
+        putchar('\n');
+    }
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc > 1 && strcmp(argv[1], "print") == 0)
+        return Print(argc > 2 ? strtoul(argv[2], NULL, 0) : DEFAULT_SEED);
+
+    uint32_t mazes = argc > 1 ? strtoul(argv[1], NULL, 0) : DEFAULT_MAZES;
+    uint32_t seed = argc > 2 ? strtoul(argv[2], NULL, 0) : DEFAULT_SEED;
+    uint64_t attempts = 0, walkable = 0, pellets = 0, junctions = 0;
+    uint32_t failed = 0, hash = 2166136261u;
+    MazeGenStats stats;
+
+    if (mazes == 0) {
+        fprintf(stderr, "Usage: bench_mazegen [mazes] [seed]\n       bench_mazegen print [seed]\n");
+        return 1;
+    }
+
+    uint64_t start = Now();
+    for (uint32_t i = 0; i < mazes; i++) {
+        if (!MazeGen_Generate(seed + i, g_Landscape, &stats)) {
+            failed++;
+            continue;
+        }
+        attempts += stats.Attempts;
+        walkable += stats.Walkable;
+        pellets += stats.Pellets;
+        junctions += stats.Junctions;
+        hash = Checksum(hash);
+    }
+    uint64_t elapsed = Now() - start;
+
+    start = Now();
+    for (uint32_t i = 0; i < mazes; i++)
+        MazeGen_Validate(g_Landscape, &stats);
+    uint64_t validation = Now() - start;
+
+    uint32_t passed = mazes - failed;
+    if (passed == 0)
+        passed = 1;
+    printf("%u mazes of %ux%u from seed %u\n", mazes, NUM_COLS, NUM_ROWS, seed);
+    printf("mazes/sec  us/maze  validate us  attempts  walkable  pellets  junctions  failed   checksum\n");
+    printf("%9.0f %8.2f %12.2f %9.2f %9.1f %8.1f %10.1f %7u   %08x\n",
+        mazes * 1e9 / elapsed, elapsed / 1e3 / mazes, validation / 1e3 / mazes,
+        (double)attempts / passed, (double)walkable / passed, (double)pellets / passed,
+        (double)junctions / passed, failed, hash);
+    return failed != 0;
+}
@@ -0,0 +1,365 @@
+// Reads the frame capture of make CAPTURE=1 (see pacman/capture.h) out of a
+// debug port log, or a COM1 log with make CAPTURE=com1: the "CAPTURE <hex>"
+// lines, other lines are skipped.
+//
+// Usage: capture_tool report <file>           a line per frame and the totals
+//        capture_tool play <file> [fps]       the frames on the terminal, in color
+//        capture_tool show <file> <frame>     one frame as text
+//        capture_tool record <file> [ticks] [seed]
+//
+// record plays the engine on the host with the capture on, the same
+// records the kernel sends, for trying the others without qemu.
+#define _POSIX_C_SOURCE 199309L
+#include "drivers.h"
+#include <pacman/game.h>
+#include <pacman/capture.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+#define CELLS                   (RENDER_ROWS * RENDER_COLS)
+#define DEFAULT_TICKS           500
+#define DEFAULT_SEED            1
+#define DEFAULT_GHOSTS          4
+#define DEFAULT_FPS             30
+#define LINE_BYTES              32
+
+typedef struct {
+    uint32_t Frame;
+    uint8_t Flags;
+    uint16_t Runs;
+    uint32_t Cells;         // changed
+    uint32_t Bytes;
+    uint64_t Timestamp;
+    uint32_t Cycles;        // the capture of the frame, from the record after it
+} FrameInfo;
+
+static FILE* g_Out;
+static uint16_t g_Page[CELLS];
+
+// VGA's color order to ANSI's: black, blue, green, cyan, red, magenta, brown, gray
+static const uint8_t g_AnsiColors[8] = { 0, 4, 2, 6, 1, 5, 3, 7 };
+
+static int HexDigit(char c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// All the bytes of the CAPTURE lines, NULL if the file can't be read
+static uint8_t* ReadLines(const char* path, uint32_t* size)
+{
+    char line[1024];
+    uint32_t capacity = 1 << 16;
+    uint8_t* data = malloc(capacity);
+    FILE* in = fopen(path, "r");
+
+    if (in == NULL || data == NULL) {
+        fprintf(stderr, "capture_tool: can't open %s\n", path);
+        free(data);
+        return NULL;
+    }
+
+    *size = 0;
+    while (fgets(line, sizeof(line), in)) {
+        const char* p = strstr(line, "CAPTURE ");
+        if (!p)
+            continue;
+        for (p += 8; HexDigit(p[0]) >= 0 && HexDigit(p[1]) >= 0; p += 2) {
+            if (*size == capacity)
+                data = realloc(data, capacity *= 2);
+            data[(*size)++] = HexDigit(p[0]) << 4 | HexDigit(p[1]);
+        }
+    }
+    fclose(in);
+    return data;
+}
+
+static uint32_t Get(const uint8_t* data, int bytes)
+{
+    uint32_t value = 0;
+    for (int i = bytes - 1; i >= 0; i--)
+        value = value << 8 | data[i];
+    return value;
+}
+
+// Applies the record at offset to the screen. Returns the offset of the
+// next record, 0 if this one is broken.
+static uint32_t Decode(const uint8_t* data, uint32_t size, uint32_t offset, uint16_t* screen, FrameInfo* info)
+{
+    const uint8_t* p = data + offset;
+    if (size - offset < CAPTURE_HEADER_SIZE || p[0] != CAPTURE_MAGIC)
+        return 0;
+
+    info->Flags = p[1];
+    info->Runs = Get(p + 2, 2);
+    info->Frame = Get(p + 4, 4);
+    info->Timestamp = Get(p + 8, 4) | (uint64_t)Get(p + 12, 4) << 32;
+    info->Cells = 0;
+    info->Cycles = 0;
+    if (info->Flags & CAPTURE_KEY)
+        memset(screen, 0, CELLS * sizeof(uint16_t));
+
+    uint32_t at = offset + CAPTURE_HEADER_SIZE;
+    for (int run = 0; run < info->Runs; run++) {
+        if (size - at < CAPTURE_RUN_SIZE)
+            return 0;
+        uint32_t first = Get(data + at, 2), count = data[at + 2];
+        bool repeat = first & CAPTURE_RUN_REPEAT;
+        first &= ~CAPTURE_RUN_REPEAT;
+        at += CAPTURE_RUN_SIZE;
+
+        uint32_t cells = repeat ? 1 : count;
+        if (first + count > CELLS || size - at < 2 * cells)
+            return 0;
+        for (uint32_t i = 0; i < count; i++)
+            screen[first + i] = Get(data + at + 2 * (repeat ? 0 : i), 2);
+        at += 2 * cells;
+        info->Cells += count;
+    }
+    info->Bytes = at - offset;
+    return at;
+}
+
+// Every frame of the capture, the screens too if screens isn't NULL. Returns the count.
+static uint32_t DecodeAll(const uint8_t* data, uint32_t size, FrameInfo** infos, uint16_t** screens)
+{
+    uint16_t screen[CELLS] = { 0 };
+    uint32_t count = 0, capacity = 256, offset = 0;
+
+    *infos = malloc(capacity * sizeof(FrameInfo));
+    if (screens)
+        *screens = malloc(capacity * sizeof(screen));
+
+    while (offset < size) {
+        if (count == capacity) {
+            capacity *= 2;
+            *infos = realloc(*infos, capacity * sizeof(FrameInfo));
+            if (screens)
+                *screens = realloc(*screens, capacity * sizeof(screen));
+        }
+        uint32_t next = Decode(data, size, offset, screen, &(*infos)[count]);
+        if (next == 0) {
+            fprintf(stderr, "capture_tool: broken record at byte %u, the rest is skipped\n", offset);
+            break;
+        }
+        // the record carries what capturing the frame before took
+        if (count > 0)
+            (*infos)[count - 1].Cycles = Get(data + offset + 16, 4);
+        if (screens)
+            memcpy(*screens + count * CELLS, screen, sizeof(screen));
+        offset = next;
+        count++;
+    }
+    return count;
+}
+
+static int Report(const char* path)
+{
+    uint32_t size;
+    uint8_t* data = ReadLines(path, &size);
+    FrameInfo* infos;
+    if (data == NULL)
+        return 1;
+
+    uint32_t count = DecodeAll(data, size, &infos, NULL);
+    uint32_t partial = 0, over = 0, maxCells = 0, maxBytes = 0, maxCycles = 0;
+    uint64_t cells = 0, bytes = 0, cycles = 0, maxInterval = 0;
+
+    printf(" frame  flags  interval cycles   runs  cells  bytes  capture cycles\n");
+    for (uint32_t i = 0; i < count; i++) {
+        const FrameInfo* info = &infos[i];
+        uint64_t interval = i > 0 && !(info->Flags & CAPTURE_KEY) ? info->Timestamp - infos[i - 1].Timestamp : 0;
+
+        printf("%6u  %c%c     %15llu %6u %6u %6u %15u\n", info->Frame,
+            info->Flags & CAPTURE_KEY ? 'K' : '-', info->Flags & CAPTURE_PARTIAL ? 'P' : '-',
+            (unsigned long long)interval, info->Runs, info->Cells, info->Bytes, info->Cycles);
+
+        partial += (info->Flags & CAPTURE_PARTIAL) != 0;
+        over += info->Cycles > CAPTURE_BUDGET_CYCLES;
+        cells += info->Cells;
+        bytes += info->Bytes;
+        cycles += info->Cycles;
+        if (info->Cells > maxCells)
+            maxCells = info->Cells;
+        if (info->Bytes > maxBytes)
+            maxBytes = info->Bytes;
+        if (info->Cycles > maxCycles)
+            maxCycles = info->Cycles;
+        if (interval > maxInterval)
+            maxInterval = interval;
+    }
+
+    if (count > 0) {
+        printf("%u frames from %u bytes, %u partial\n", count, size, partial);
+        printf("changed cells %.1f avg, %u max; record bytes %.1f avg, %u max\n",
+            (double)cells / count, maxCells, (double)bytes / count, maxBytes);
+        printf("frame interval %.0f cycles avg, %llu max\n",
+            count > 1 ? (double)(infos[count - 1].Timestamp - infos[0].Timestamp) / (count - 1) : 0.0,
+            (unsigned long long)maxInterval);
+        printf("capture %.0f cycles avg, %u max, %u frames over the budget of %u\n",
+            (double)cycles / count, maxCycles, over, CAPTURE_BUDGET_CYCLES);
+    }
+    free(infos);
+    free(data);
+    return 0;
+}
+
+static char Glyph(uint16_t cell)
+{
+    uint8_t chr = cell & 0xFF;
+    if (chr == 0)
+        return ' ';
+    return chr >= 0x20 && chr < 0x7F ? chr : '#';
+}
+
+static int Play(const char* path, uint32_t fps, int only)
+{
+    uint32_t size;
+    uint8_t* data = ReadLines(path, &size);
+    FrameInfo* infos;
+    uint16_t* screens;
+    if (data == NULL)
+        return 1;
+
+    uint32_t count = DecodeAll(data, size, &infos, &screens);
+    if (only >= (int)count) {
+        fprintf(stderr, "capture_tool: the capture has %u frames\n", count);
+        return 1;
+    }
+
+    struct timespec pause = { 0, 1000000000L / fps };
+    for (uint32_t i = only >= 0 ? only : 0; i < count; i++) {
+        const uint16_t* screen = screens + i * CELLS;
+        if (only >= 0) {
+            for (int y = 0; y < RENDER_ROWS; y++) {
+                for (int x = 0; x < RENDER_COLS; x++)
+                    putchar(Glyph(screen[y * RENDER_COLS + x]));
+                putchar('\n');
+            }
+            break;
+        }
+
+        printf("\x1b[H");
+        for (int y = 0; y < RENDER_ROWS; y++) {
+            int last = -1;
+            for (int x = 0; x < RENDER_COLS; x++) {
+                uint16_t cell = screen[y * RENDER_COLS + x];
+                int attribute = cell >> 8;
+                if (attribute != last) {
+                    printf("\x1b[%d;%dm", (attribute & 8 ? 90 : 30) + g_AnsiColors[attribute & 7],
+                        (attribute & 0x80 ? 100 : 40) + g_AnsiColors[(attribute >> 4) & 7]);
+                    last = attribute;
+                }
+                putchar(Glyph(cell));
+            }
+            printf("\x1b[0m\n");
+        }
+        printf("frame %u/%u %s%s\x1b[K\n", infos[i].Frame, count,
+            infos[i].Flags & CAPTURE_KEY ? "key " : "", infos[i].Flags & CAPTURE_PARTIAL ? "partial" : "");
+        fflush(stdout);
+        nanosleep(&pause, NULL);
+    }
+    free(screens);
+    free(infos);
+    free(data);
+    return 0;
+}
+
+// A page the host keeps for the capture, the way the VGA driver flips its pages to it
+static void RenderPage_Initialize(int pages, bool waitRetrace)
+{
+    memset(g_Page, 0, sizeof(g_Page));
+}
+
+static int RenderPage_BackPage()
+{
+    return 0;
+}
+
+static void RenderPage_PutCell(int x, int y, uint16_t cell)
+{
+    g_Page[y * RENDER_COLS + x] = cell;
+}
+
+static void RenderPage_Flip()
+{
+    Capture_Frame(g_Page);
+}
+
+static const RenderDriver g_RenderPageDriver = {
+    .Name = "capture",
+    .Initialize = &RenderPage_Initialize,
+    .BackPage = &RenderPage_BackPage,
+    .PutCell = &RenderPage_PutCell,
+    .Flip = &RenderPage_Flip,
+};
+
+static void WriteLines(const uint8_t* data, uint32_t size)
+{
+    while (size > 0) {
+        uint32_t count = size < LINE_BYTES ? size : LINE_BYTES;
+        fprintf(g_Out, "CAPTURE ");
+        for (uint32_t i = 0; i < count; i++)
+            fprintf(g_Out, "%02x", data[i]);
+        fprintf(g_Out, "\n");
+        data += count;
+        size -= count;
+    }
+}
+
+static int Record(const char* path, uint32_t ticks, uint32_t seed)
+{
+    g_Out = fopen(path, "w");
+    if (!g_Out) {
+        fprintf(stderr, "capture_tool: can't write %s\n", path);
+        return 1;
+    }
+
+    GameConfig config = {
+        .Render = &g_RenderPageDriver,
+        .Input = InputScript_GetDriver(),
+        .WaitRetrace = false,
+        .Seed = seed,
+        .Ghosts = DEFAULT_GHOSTS,
+        .Generate = GAME_GENERATE,
+    };
+    InputScript_Seed(seed);
+    Capture_Start(WriteLines);
+    Game_Initialize(&config);
+    for (uint32_t i = 0; i < ticks; i++)
+        Game_Step();
+    fclose(g_Out);
+
+    const CaptureStats* stats = Capture_GetStats();
+    fprintf(stderr, "capture_tool: %u frames, %u bytes, %u cells, %u partial, %.0f cycles avg, %u max\n",
+        stats->Frames, stats->Bytes, stats->Cells, stats->Partial,
+        stats->Frames ? (double)stats->TotalCycles / stats->Frames : 0.0, stats->MaxCycles);
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc == 3 && strcmp(argv[1], "report") == 0)
+        return Report(argv[2]);
+    if ((argc == 3 || argc == 4) && strcmp(argv[1], "play") == 0) {
+        uint32_t fps = argc > 3 ? strtoul(argv[3], NULL, 0) : DEFAULT_FPS;
+        return Play(argv[2], fps > 0 ? fps : DEFAULT_FPS, -1);
+    }
+    if (argc == 4 && strcmp(argv[1], "show") == 0 && atoi(argv[3]) >= 0)
+        return Play(argv[2], DEFAULT_FPS, atoi(argv[3]));
+    if (argc >= 3 && strcmp(argv[1], "record") == 0)
+        return Record(argv[2], argc > 3 ? strtoul(argv[3], NULL, 0) : DEFAULT_TICKS,
+            argc > 4 ? strtoul(argv[4], NULL, 0) : DEFAULT_SEED);
+
+    fprintf(stderr, "Usage: capture_tool report <file>\n");
+    fprintf(stderr, "       capture_tool play <file> [fps]\n");
+    fprintf(stderr, "       capture_tool show <file> <frame>\n");
+    fprintf(stderr, "       capture_tool record <file> [ticks] [seed]\n");
+    return 1;
+}
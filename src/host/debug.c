@@ -0,0 +1,17 @@
+#include "debug.h"
+#include <stdio.h>
+#include <stdarg.h>
+
+void Host_Log(const char* module, DebugLevel level, const char* fmt, ...)
+{
+    va_list args;
+
+    if (level < MIN_LOG_LEVEL)
+        return;
+
+    va_start(args, fmt);
+    fprintf(stderr, "[%s] ", module);
+    vfprintf(stderr, fmt, args);
+    fputc('\n', stderr);
+    va_end(args);
+}
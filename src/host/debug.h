@@ -0,0 +1,22 @@
+#pragma once
+
+// The kernel's debug.h for the host build, the engine's log goes to stderr.
+// Comes first in the include path, so <debug.h> in the engine finds this one.
+
+#define MIN_LOG_LEVEL LVL_WARN
+
+typedef enum {
+    LVL_DEBUG = 0,
+    LVL_INFO = 1,
+    LVL_WARN = 2,
+    LVL_ERROR = 3,
+    LVL_CRITICAL = 4
+} DebugLevel;
+
+// not logf, the host has that one in libm
+void Host_Log(const char* module, DebugLevel level, const char* fmt, ...);
+#define log_debug(module, ...) Host_Log(module, LVL_DEBUG, __VA_ARGS__)
+#define log_info(module, ...) Host_Log(module, LVL_INFO, __VA_ARGS__)
+#define log_warn(module, ...) Host_Log(module, LVL_WARN, __VA_ARGS__)
+#define log_err(module, ...) Host_Log(module, LVL_ERROR, __VA_ARGS__)
+#define log_crit(module, ...) Host_Log(module, LVL_CRITICAL, __VA_ARGS__)
@@ -0,0 +1,179 @@
+#define _POSIX_C_SOURCE 199309L
+#include "drivers.h"
+#include <arch/i686/tsc.h>
+#include <time.h>
+#include <unistd.h>
+
+#define SCRIPT_PERIOD           4   // ticks between two key presses
+#define SCANCODE_EXTENDED       0xE0
+#define SCANCODE_RELEASED       0x80
+#define LINK_DELAY_QUEUE        4096    // must be a power of 2
+
+//
+// Render
+//
+
+static int g_BackPage;
+static uint32_t g_Cells;
+
+static void RenderNull_Initialize(int pages, bool waitRetrace)
+{
+    g_BackPage = pages > 1 ? 1 : 0;
+    g_Cells = 0;
+}
+
+static int RenderNull_BackPage()
+{
+    return g_BackPage;
+}
+
+static void RenderNull_PutCell(int x, int y, uint16_t cell)
+{
+    g_Cells++;
+}
+
+static void RenderNull_Flip()
+{
+    g_BackPage ^= 1;
+}
+
+static const RenderDriver g_RenderNullDriver = {
+    .Name = "null",
+    .Initialize = &RenderNull_Initialize,
+    .BackPage = &RenderNull_BackPage,
+    .PutCell = &RenderNull_PutCell,
+    .Flip = &RenderNull_Flip,
+};
+
+const RenderDriver* RenderNull_GetDriver()
+{
+    return &g_RenderNullDriver;
+}
+
+uint32_t RenderNull_GetCells()
+{
+    return g_Cells;
+}
+
+//
+// Input
+//
+
+static const uint8_t g_Arrows[] = { 0x4B, 0x4D, 0x48, 0x50 };    // left, right, up, down
+static uint32_t g_ScriptState = 1;
+
+void InputScript_Seed(uint32_t seed)
+{
+    g_ScriptState = seed != 0 ? seed : 1;
+}
+
+static void InputScript_Initialize()
+{
+}
+
+static void InputScript_Shutdown()
+{
+}
+
+// A press and a release, the way the keyboard IRQ delivers them
+static void InputScript_Poll(uint32_t tick)
+{
+    if (tick % SCRIPT_PERIOD != 0)
+        return;
+
+    g_ScriptState ^= g_ScriptState << 13;
+    g_ScriptState ^= g_ScriptState >> 17;
+    g_ScriptState ^= g_ScriptState << 5;
+    uint8_t arrow = g_Arrows[g_ScriptState & 3];
+
+    Input_OnScancode(SCANCODE_EXTENDED, i686_rdtsc());
+    Input_OnScancode(arrow, i686_rdtsc());
+    Input_OnScancode(SCANCODE_EXTENDED, i686_rdtsc());
+    Input_OnScancode(arrow | SCANCODE_RELEASED, i686_rdtsc());
+}
+
+static const InputDriver g_InputScriptDriver = {
+    .Name = "script",
+    .Initialize = &InputScript_Initialize,
+    .Shutdown = &InputScript_Shutdown,
+    .Poll = &InputScript_Poll,
+};
+
+const InputDriver* InputScript_GetDriver()
+{
+    return &g_InputScriptDriver;
+}
+
+//
+// Link
+//
+
+static int g_LinkFd;
+static uint64_t g_LinkLatency;
+
+// The bytes sent, held back until they're due
+static struct {
+    uint64_t Due;
+    uint8_t Byte;
+} g_Delayed[LINK_DELAY_QUEUE];
+static uint32_t g_DelayedHead;
+static uint32_t g_DelayedTail;
+
+static uint64_t LinkPipe_Now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+void LinkPipe_Open(int fd, uint32_t latencyUs)
+{
+    g_LinkFd = fd;
+    g_LinkLatency = latencyUs * 1000ull;
+    g_DelayedHead = g_DelayedTail = 0;
+}
+
+bool LinkPipe_Idle()
+{
+    return g_DelayedHead == g_DelayedTail;
+}
+
+static void LinkPipe_Initialize()
+{
+}
+
+static bool LinkPipe_Send(uint8_t byte)
+{
+    if (g_DelayedHead - g_DelayedTail == LINK_DELAY_QUEUE)
+        return false;
+
+    g_Delayed[g_DelayedHead & (LINK_DELAY_QUEUE - 1)].Due = LinkPipe_Now() + g_LinkLatency;
+    g_Delayed[g_DelayedHead & (LINK_DELAY_QUEUE - 1)].Byte = byte;
+    g_DelayedHead++;
+    return true;
+}
+
+// Lets out the bytes that are due on the way
+static bool LinkPipe_Receive(uint8_t* byte)
+{
+    uint64_t now = LinkPipe_Now();
+
+    while (g_DelayedTail != g_DelayedHead && g_Delayed[g_DelayedTail & (LINK_DELAY_QUEUE - 1)].Due <= now) {
+        if (write(g_LinkFd, &g_Delayed[g_DelayedTail & (LINK_DELAY_QUEUE - 1)].Byte, 1) != 1)
+            break;
+        g_DelayedTail++;
+    }
+    return read(g_LinkFd, byte, 1) == 1;
+}
+
+static const LinkDriver g_LinkPipeDriver = {
+    .Name = "pipe",
+    .Initialize = &LinkPipe_Initialize,
+    .Send = &LinkPipe_Send,
+    .Receive = &LinkPipe_Receive,
+};
+
+const LinkDriver* LinkPipe_GetDriver()
+{
+    return &g_LinkPipeDriver;
+}
@@ -0,0 +1,18 @@
+#pragma once
+#include <pacman/render.h>
+#include <pacman/input.h>
+#include <pacman/netplay.h>
+
+// Counts the cells instead of drawing them
+const RenderDriver* RenderNull_GetDriver();
+uint32_t RenderNull_GetCells();
+
+// Presses a random arrow key every few ticks, the same keys for the same seed
+void InputScript_Seed(uint32_t seed);
+const InputDriver* InputScript_GetDriver();
+
+// The peer at the other end of a non-blocking socket, every byte held back
+// for the latency before it goes out
+void LinkPipe_Open(int fd, uint32_t latencyUs);
+bool LinkPipe_Idle();       // all the bytes sent went out
+const LinkDriver* LinkPipe_GetDriver();
@@ -0,0 +1,134 @@
+// Two-player sessions of the pacman simulation on the host: two processes
+// joined by a socket pair stand in for the two qemu instances of
+// make NETPLAY=1. The line holds every byte back for the latency, both
+// sides press scripted keys at the tick rate, and at the end both have to
+// agree on the state hash, however many ticks they played again.
+//
+// Usage: netplay_tool [ticks] [latency in ms] [seed]
+#define _POSIX_C_SOURCE 199309L
+#include "drivers.h"
+#include <pacman/game.h>
+#include <pacman/netplay.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+
+#define DEFAULT_TICKS           3000
+#define DEFAULT_LATENCY_MS      30
+#define DEFAULT_SEED            1
+#define DEFAULT_GHOSTS          4
+#define TICK_NS                 10000000ull     // 100 ticks per second
+
+static uint64_t Now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+// The last arrow the script pressed for the tick
+static uint8_t ScriptMove(uint32_t tick)
+{
+    uint8_t move = GAME_MOVE_NONE;
+    InputEvent event;
+
+    InputScript_GetDriver()->Poll(tick);
+    while (Input_Pop(&event))
+        if (event.Key != INPUT_KEY_OTHER && !event.Released)
+            move = event.Key;
+    return move;
+}
+
+// One side of the session, returns its state hash after the last tick
+static uint32_t Peer(int fd, uint32_t ticks, uint32_t latencyMs, uint32_t nonce)
+{
+    bool pacman;
+
+    LinkPipe_Open(fd, latencyMs * 1000);
+    uint32_t seed = Netplay_Connect(LinkPipe_GetDriver(), nonce, &pacman);
+
+    GameConfig config = {
+        .Render = RenderNull_GetDriver(),
+        .Input = InputScript_GetDriver(),
+        .WaitRetrace = false,
+        .Seed = seed,
+        .Ghosts = DEFAULT_GHOSTS,
+        .TwoPlayer = true,
+    };
+    InputScript_Seed(nonce);
+    Game_Initialize(&config);
+    Netplay_Start(pacman);
+
+    uint64_t start = Now(), next = start;
+    uint8_t move = ScriptMove(0);
+    while (Game_GetTick() < ticks) {
+        while (Now() < next)
+            Netplay_Poll();
+        if (Netplay_Update(move)) {
+            move = ScriptMove(Game_GetTick());
+            next += TICK_NS;
+        }
+    }
+
+    // the peer's last moves, then ours have to get out before the socket closes
+    while (Netplay_GetStats()->Confirmed < ticks || !LinkPipe_Idle())
+        Netplay_Poll();
+    uint64_t elapsed = Now() - start;
+
+    const NetplayStats* stats = Netplay_GetStats();
+    printf("%-7s %8u %6u %6u %9u %8u %6u %10.1f %10.1f %6u %6u %5u   %08x\n", pacman ? "pacman" : "ghost",
+        Game_GetTick(), Game_GetGames(), stats->Stalls, stats->Rollbacks, stats->ReplayedTicks, stats->MaxDepth,
+        stats->Rollbacks ? stats->ReplayCycles / 1e3 / stats->Rollbacks : 0.0, elapsed / 1e6,
+        stats->BytesSent, stats->BytesReceived, stats->BadPackets, Game_StateHash());
+    fflush(stdout);
+    return Game_StateHash();
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t ticks = argc > 1 ? strtoul(argv[1], NULL, 0) : DEFAULT_TICKS;
+    uint32_t latency = argc > 2 ? strtoul(argv[2], NULL, 0) : DEFAULT_LATENCY_MS;
+    uint32_t seed = argc > 3 ? strtoul(argv[3], NULL, 0) : DEFAULT_SEED;
+    int line[2], results[2];
+    uint32_t hashes[2];
+
+    if (ticks == 0) {
+        fprintf(stderr, "Usage: netplay_tool [ticks] [latency in ms] [seed]\n");
+        return 1;
+    }
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, line) != 0 || pipe(results) != 0) {
+        perror("netplay_tool");
+        return 1;
+    }
+    fcntl(line[0], F_SETFL, O_NONBLOCK);
+    fcntl(line[1], F_SETFL, O_NONBLOCK);
+
+    printf("%u ticks, %u ms each way, %u ticks per second\n", ticks, latency, (uint32_t)(1000000000ull / TICK_NS));
+    printf("side       ticks  games stalls rollbacks replayed  depth  us/rollbk    time ms    out     in   bad   hash\n");
+    fflush(stdout);
+    for (int side = 0; side < 2; side++) {
+        if (fork() == 0) {
+            uint32_t hash = Peer(line[side], ticks, latency, seed * 2 + side);
+            if (write(results[1], &hash, sizeof(hash)) != sizeof(hash))
+                _exit(1);
+            _exit(0);
+        }
+    }
+
+    for (int side = 0; side < 2; side++)
+        if (read(results[0], &hashes[side], sizeof(hashes[side])) != sizeof(hashes[side]))
+            return 1;
+    while (wait(NULL) > 0);
+
+    if (hashes[0] != hashes[1]) {
+        printf("desync: the two sides ended in different states\n");
+        return 1;
+    }
+    printf("in sync\n");
+    return 0;
+}
@@ -0,0 +1,209 @@
+// Records and replays games of the pacman simulation on the host.
+//
+// Usage: replay_tool record <file> [ticks] [seed]
+//        replay_tool play <file>
+//
+// Both print the state hash after every tick, "tick <n> hash <x>", the same
+// lines the kernel logs when it's built with make RECORD=1. The file holds the
+// "REPLAY <hex>" lines of the recording and the hash lines, other lines are
+// skipped, so a debug port capture of the kernel (qemu -debugcon file:e9.log)
+// plays as it is. play checks every tick against the hash the file has for
+// it and exits with 2 on the first that differs.
+#define _POSIX_C_SOURCE 199309L
+#include "drivers.h"
+#include <pacman/game.h>
+#include <pacman/replay.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+#define DEFAULT_TICKS           500
+#define DEFAULT_SEED            1
+#define DEFAULT_GHOSTS          4
+#define LINE_BYTES              32
+
+// The hashes of the file by tick, Known where it has one
+typedef struct {
+    uint32_t* Hashes;
+    bool* Known;
+    uint32_t Count;
+} HashLines;
+
+static FILE* g_Out;
+
+static uint64_t Now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static void WriteLines(const uint8_t* data, uint32_t size)
+{
+    while (size > 0) {
+        uint32_t count = size < LINE_BYTES ? size : LINE_BYTES;
+        fprintf(g_Out, "REPLAY ");
+        for (uint32_t i = 0; i < count; i++)
+            fprintf(g_Out, "%02x", data[i]);
+        fprintf(g_Out, "\n");
+        data += count;
+        size -= count;
+    }
+}
+
+static int HexDigit(char c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// A "tick <n> hash <x>" line, the kernel's end with the color reset. The
+// kernel's own replay check logs "tick <n> hash <x>, recorded <y>", which isn't one.
+static bool ReadHash(const char* line, HashLines* hashes)
+{
+    const char* p = strstr(line, "tick ");
+    unsigned tick, hash;
+    int length;
+
+    if (!p || sscanf(p, "tick %u hash %x%n", &tick, &hash, &length) != 2 || tick == 0)
+        return false;
+    if (p[length] != '\0' && p[length] != '\n' && p[length] != '\r' && p[length] != '\033')
+        return false;
+
+    if (tick > hashes->Count) {
+        uint32_t count = tick > 2 * hashes->Count ? tick : 2 * hashes->Count;
+        hashes->Hashes = realloc(hashes->Hashes, count * sizeof(uint32_t));
+        hashes->Known = realloc(hashes->Known, count * sizeof(bool));
+        memset(hashes->Known + hashes->Count, 0, (count - hashes->Count) * sizeof(bool));
+        hashes->Count = count;
+    }
+    hashes->Hashes[tick - 1] = hash;
+    hashes->Known[tick - 1] = true;
+    return true;
+}
+
+static uint32_t ReadLines(FILE* in, uint8_t* data, uint32_t capacity, HashLines* hashes)
+{
+    char line[1024];
+    uint32_t size = 0;
+
+    while (fgets(line, sizeof(line), in)) {
+        const char* p = strstr(line, "REPLAY ");
+        if (!p) {
+            ReadHash(line, hashes);
+            continue;
+        }
+        for (p += 7; HexDigit(p[0]) >= 0 && HexDigit(p[1]) >= 0 && size < capacity; p += 2)
+            data[size++] = HexDigit(p[0]) << 4 | HexDigit(p[1]);
+    }
+    return size;
+}
+
+static int Record(const char* path, uint32_t ticks, uint32_t seed)
+{
+    g_Out = fopen(path, "w");
+    if (!g_Out) {
+        fprintf(stderr, "replay_tool: can't write %s\n", path);
+        return 1;
+    }
+
+    GameConfig config = {
+        .Render = RenderNull_GetDriver(),
+        .Input = InputScript_GetDriver(),
+        .WaitRetrace = false,
+        .Seed = seed,
+        .Ghosts = DEFAULT_GHOSTS,
+        .Record = true,
+        .RecordSink = WriteLines,
+        .Generate = GAME_GENERATE,
+    };
+    InputScript_Seed(seed);
+    Game_Initialize(&config);
+
+    for (uint32_t i = 0; i < ticks; i++) {
+        Game_Step();
+        printf("tick %u hash %x\n", Game_GetTick(), Game_StateHash());
+        fprintf(g_Out, "tick %u hash %x\n", Game_GetTick(), Game_StateHash());
+    }
+    Game_StopRecording();
+    fclose(g_Out);
+    return 0;
+}
+
+static int Play(const char* path)
+{
+    static uint8_t data[REPLAY_BUFFER_SIZE];
+    ReplayHeader header;
+    HashLines hashes = { NULL, NULL, 0 };
+
+    FILE* in = fopen(path, "r");
+    if (!in) {
+        fprintf(stderr, "replay_tool: can't open %s\n", path);
+        return 1;
+    }
+    uint32_t size = ReadLines(in, data, sizeof(data), &hashes);
+    fclose(in);
+
+    if (!Replay_Open(data, size, &header)) {
+        fprintf(stderr, "replay_tool: no recording in %s\n", path);
+        return 1;
+    }
+
+    GameConfig config = {
+        .Render = RenderNull_GetDriver(),
+        .Input = Replay_GetDriver(),
+        .WaitRetrace = false,
+        .Seed = header.Seed,
+        .Ghosts = header.Ghosts,
+        .Generate = GAME_GENERATE,
+    };
+    Game_Initialize(&config);
+
+    uint32_t checked = 0;
+    uint64_t start = Now();
+    while (!Replay_Finished(Game_GetTick())) {
+        Game_Step();
+        uint32_t tick = Game_GetTick(), hash = Game_StateHash();
+        printf("tick %u hash %x\n", tick, hash);
+
+        if (tick > hashes.Count || !hashes.Known[tick - 1])
+            continue;
+        if (hash != hashes.Hashes[tick - 1]) {
+            fprintf(stderr, "replay_tool: tick %u hash %x, recorded %x\n", tick, hash, hashes.Hashes[tick - 1]);
+            break;
+        }
+        checked++;
+    }
+    uint64_t elapsed = Now() - start;
+    free(hashes.Hashes);
+    free(hashes.Known);
+    if (!Replay_Finished(Game_GetTick()))
+        return 2;
+
+    fprintf(stderr, "replay_tool: %u ticks from %u bytes, seed %u, %u ghosts, %.0f ns/tick\n",
+        Game_GetTick(), size, header.Seed, header.Ghosts,
+        Game_GetTick() ? (double)elapsed / Game_GetTick() : 0.0);
+    if (checked == 0)
+        fprintf(stderr, "replay_tool: no hashes in %s, nothing checked\n", path);
+    else
+        fprintf(stderr, "replay_tool: %u ticks match the recorded hashes\n", checked);
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc >= 3 && strcmp(argv[1], "record") == 0)
+        return Record(argv[2], argc > 3 ? strtoul(argv[3], NULL, 0) : DEFAULT_TICKS,
+            argc > 4 ? strtoul(argv[4], NULL, 0) : DEFAULT_SEED);
+    if (argc == 3 && strcmp(argv[1], "play") == 0)
+        return Play(argv[2]);
+
+    fprintf(stderr, "Usage: replay_tool record <file> [ticks] [seed]\n");
+    fprintf(stderr, "       replay_tool play <file>\n");
+    return 1;
+}
@@ -30,6 +30,14 @@ i686_DisableInterrupts:
     cli
     ret
 
+; sti takes effect after the next instruction, so no interrupt comes
+; between the two and the hlt can't miss the one it waits for
+global i686_Halt
+i686_Halt:
+    sti
+    hlt
+    ret
+
 global crash_me
 crash_me:
     ; div by 0
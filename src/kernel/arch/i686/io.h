@@ -6,5 +6,8 @@ uint8_t __attribute__((cdecl)) i686_inb(uint16_t port);
 uint8_t __attribute__((cdecl)) i686_EnableInterrupts();
 uint8_t __attribute__((cdecl)) i686_DisableInterrupts();
 
+// Enables the interrupts and sleeps until the next one
+void __attribute__((cdecl)) i686_Halt();
+
 void i686_iowait();
 void __attribute__((cdecl)) i686_Panic();
@@ -0,0 +1,52 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+// The hardware random number generator: rdseed gives conditioned entropy,
+// rdrand the output of a DRBG reseeded from it. Both can run dry for a
+// moment and report it in the carry flag.
+
+static inline void i686_cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4])
+{
+    __asm__ volatile ("cpuid"
+        : "=a"(regs[0]), "=b"(regs[1]), "=c"(regs[2]), "=d"(regs[3])
+        : "a"(leaf), "c"(subleaf));
+}
+
+static inline bool i686_HasRdrand()
+{
+    uint32_t regs[4];
+    i686_cpuid(1, 0, regs);
+    return (regs[2] >> 30) & 1;     // ECX bit 30
+}
+
+static inline bool i686_HasRdseed()
+{
+    uint32_t regs[4];
+    i686_cpuid(0, 0, regs);
+    if (regs[0] < 7)
+        return false;
+    i686_cpuid(7, 0, regs);
+    return (regs[1] >> 18) & 1;     // EBX bit 18
+}
+
+// False if there was no random number ready, the value is garbage then
+static inline bool i686_Rdrand(uint32_t* value)
+{
+    uint8_t success;
+    __asm__ volatile ("rdrand %0; setc %1" : "=r"(*value), "=qm"(success) :: "cc");
+    return success;
+}
+
+static inline bool i686_Rdseed(uint32_t* value)
+{
+    uint8_t success;
+    __asm__ volatile ("rdseed %0; setc %1" : "=r"(*value), "=qm"(success) :: "cc");
+    return success;
+}
+
+// Spin-wait hint, lets the DRNG catch up between retries
+static inline void i686_Pause()
+{
+    __asm__ volatile ("pause");
+}
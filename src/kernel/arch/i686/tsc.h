@@ -0,0 +1,10 @@
+#pragma once
+#include <stdint.h>
+
+// Time stamp counter, counts CPU cycles since reset
+static inline uint64_t i686_rdtsc()
+{
+    uint32_t low, high;
+    __asm__ volatile ("rdtsc" : "=a"(low), "=d"(high));
+    return ((uint64_t)high << 32) | low;
+}
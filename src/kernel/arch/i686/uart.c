@@ -0,0 +1,55 @@
+#include "uart.h"
+#include <arch/i686/io.h>
+
+// Register offsets from the port
+#define UART_DATA               0   // the divisor's low byte while DLAB is set
+#define UART_INTERRUPTS         1   // the divisor's high byte while DLAB is set
+#define UART_FIFO_CONTROL       2
+#define UART_LINE_CONTROL       3
+#define UART_MODEM_CONTROL      4
+#define UART_LINE_STATUS        5
+
+#define LINE_CONTROL_8N1        0x03
+#define LINE_CONTROL_DLAB       0x80    // the first two registers take the divisor
+#define FIFO_ENABLE_CLEAR       0xC7    // both FIFOs on and emptied, receive threshold 14 bytes
+#define MODEM_DTR_RTS           0x03
+#define LINE_STATUS_DATA_READY  0x01
+#define LINE_STATUS_THR_EMPTY   0x20
+
+void i686_UART_Initialize(uint16_t port, uint16_t divisor)
+{
+    i686_outb(port + UART_INTERRUPTS, 0);
+    i686_outb(port + UART_LINE_CONTROL, LINE_CONTROL_DLAB);
+    i686_outb(port + UART_DATA, divisor & 0xFF);
+    i686_outb(port + UART_INTERRUPTS, divisor >> 8);
+    i686_outb(port + UART_LINE_CONTROL, LINE_CONTROL_8N1);
+    i686_outb(port + UART_FIFO_CONTROL, FIFO_ENABLE_CLEAR);
+    i686_outb(port + UART_MODEM_CONTROL, MODEM_DTR_RTS);
+}
+
+bool i686_UART_TryWrite(uint16_t port, uint8_t byte)
+{
+    if (!(i686_inb(port + UART_LINE_STATUS) & LINE_STATUS_THR_EMPTY))
+        return false;
+    i686_outb(port + UART_DATA, byte);
+    return true;
+}
+
+uint32_t i686_UART_Write(uint16_t port, const uint8_t* data, uint32_t size)
+{
+    if (!(i686_inb(port + UART_LINE_STATUS) & LINE_STATUS_THR_EMPTY))
+        return 0;
+
+    uint32_t count = size < UART_FIFO_SIZE ? size : UART_FIFO_SIZE;
+    for (uint32_t i = 0; i < count; i++)
+        i686_outb(port + UART_DATA, data[i]);
+    return count;
+}
+
+bool i686_UART_TryRead(uint16_t port, uint8_t* byte)
+{
+    if (!(i686_inb(port + UART_LINE_STATUS) & LINE_STATUS_DATA_READY))
+        return false;
+    *byte = i686_inb(port + UART_DATA);
+    return true;
+}
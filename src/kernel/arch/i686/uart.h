@@ -0,0 +1,22 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+// The 16550 UART of a serial port, polled rather than on its IRQ: a byte
+// goes out when the transmitter has room, the bytes that came in wait in
+// the receive FIFO until they're read
+#define UART_COM1               0x3F8
+#define UART_FIFO_SIZE          16
+
+// 8 data bits, no parity, 1 stop bit, at 115200 / divisor baud
+void i686_UART_Initialize(uint16_t port, uint16_t divisor);
+
+// False if the transmitter is still busy
+bool i686_UART_TryWrite(uint16_t port, uint8_t byte);
+
+// As many of the bytes as the transmit FIFO takes: all of it once it's
+// empty, none while it isn't. Returns how many went.
+uint32_t i686_UART_Write(uint16_t port, const uint8_t* data, uint32_t size);
+
+// False if nothing arrived
+bool i686_UART_TryRead(uint16_t port, uint8_t* byte);
@@ -8,17 +8,43 @@ const unsigned SCREEN_WIDTH = 80;
 const unsigned SCREEN_HEIGHT = 25;
 const uint8_t DEFAULT_COLOR = 0x7;
 
-uint8_t* g_ScreenBuffer = (uint8_t*)0xB8000;
+// The text mode memory window (0xB8000-0xBFFFF) holds 8 pages of 4KB,
+// we use up to 2 of them for double buffering
+#define VGA_MEMORY                  0xB8000
+#define VGA_PAGE_SIZE               0x1000
+#define VGA_MAX_PAGES               2
+
+#define VGA_CRTC_INDEX_PORT         0x3D4
+#define VGA_CRTC_DATA_PORT          0x3D5
+#define VGA_CRTC_START_ADDRESS_HIGH 0x0C
+#define VGA_CRTC_START_ADDRESS_LOW  0x0D
+#define VGA_INPUT_STATUS_PORT       0x3DA
+#define VGA_STATUS_VRETRACE         0x08
+
+uint8_t* g_ScreenBuffer = (uint8_t*)VGA_MEMORY;     // the visible page
+uint8_t* g_BackBuffer = (uint8_t*)VGA_MEMORY;       // the page VGA_putcell draws into
 int g_ScreenX = 0, g_ScreenY = 0;
 
+static int g_PageCount = 1;
+static int g_FrontPage = 0;
+static bool g_WaitRetrace = true;
+
+static uint8_t* VGA_page(int page)
+{
+    return (uint8_t*)VGA_MEMORY + page * VGA_PAGE_SIZE;
+}
+
+// The console is written to every page, so it survives the flips
 void VGA_putchr(int x, int y, char c)
 {
-    g_ScreenBuffer[2 * (y * SCREEN_WIDTH + x)] = c;
+    for (int page = 0; page < g_PageCount; page++)
+        VGA_page(page)[2 * (y * SCREEN_WIDTH + x)] = c;
 }
 
 void VGA_putcolor(int x, int y, uint8_t color)
 {
-    g_ScreenBuffer[2 * (y * SCREEN_WIDTH + x) + 1] = color;
+    for (int page = 0; page < g_PageCount; page++)
+        VGA_page(page)[2 * (y * SCREEN_WIDTH + x) + 1] = color;
 }
 
 char VGA_getchr(int x, int y)
@@ -31,9 +57,16 @@ uint8_t VGA_getcolor(int x, int y)
     return g_ScreenBuffer[2 * (y * SCREEN_WIDTH + x) + 1];
 }
 
+// Writes character and attribute to the back page with a single 16-bit store
+void VGA_putcell(int x, int y, uint16_t cell)
+{
+    ((uint16_t*)g_BackBuffer)[y * SCREEN_WIDTH + x] = cell;
+}
+
 void VGA_setcursor(int x, int y)
 {
-    int pos = y * SCREEN_WIDTH + x;
+    // the cursor location is relative to the start of the video memory, not to the page
+    int pos = g_FrontPage * VGA_PAGE_SIZE / 2 + y * SCREEN_WIDTH + x;
 
     i686_outb(0x3D4, 0x0F);
     i686_outb(0x3D5, (uint8_t)(pos & 0xFF));
@@ -108,3 +141,67 @@ void VGA_putc(char c)
 
     VGA_setcursor(g_ScreenX, g_ScreenY);
 }
+
+// 1 page: VGA_putcell draws straight into the visible page.
+// 2 pages: VGA_putcell draws into the hidden page, which VGA_flip() makes visible.
+void VGA_setpages(int count)
+{
+    if (count < 1)
+        count = 1;
+    if (count > VGA_MAX_PAGES)
+        count = VGA_MAX_PAGES;
+
+    // start from a copy of the visible page, so nothing disappears on the first flip
+    for (int page = 0; page < count; page++)
+        if (page != g_FrontPage)
+            for (int i = 0; i < SCREEN_WIDTH * SCREEN_HEIGHT * 2; i++)
+                VGA_page(page)[i] = g_ScreenBuffer[i];
+
+    g_PageCount = count;
+    g_BackBuffer = VGA_page((g_FrontPage + 1) % g_PageCount);
+}
+
+int VGA_backpage()
+{
+    return (g_FrontPage + 1) % g_PageCount;
+}
+
+// The cells of the page, the character in the low byte and the attribute in the high one
+const uint16_t* VGA_pagecells(int page)
+{
+    return (const uint16_t*)VGA_page(page);
+}
+
+// Benchmark runs don't want to be throttled to the refresh rate
+void VGA_setvsync(bool wait)
+{
+    g_WaitRetrace = wait;
+}
+
+void VGA_flip()
+{
+    if (g_PageCount == 1)
+        return;
+
+    int page = VGA_backpage();
+    uint16_t start = page * VGA_PAGE_SIZE / 2;      // in character cells
+
+    // The CRTC latches the start address at the beginning of the vertical retrace.
+    // Program it outside of the retrace and wait for the next one, after that
+    // the old front page is no longer scanned out and can be drawn into.
+    if (g_WaitRetrace)
+        while (i686_inb(VGA_INPUT_STATUS_PORT) & VGA_STATUS_VRETRACE);
+
+    i686_outb(VGA_CRTC_INDEX_PORT, VGA_CRTC_START_ADDRESS_HIGH);
+    i686_outb(VGA_CRTC_DATA_PORT, (uint8_t)(start >> 8));
+    i686_outb(VGA_CRTC_INDEX_PORT, VGA_CRTC_START_ADDRESS_LOW);
+    i686_outb(VGA_CRTC_DATA_PORT, (uint8_t)(start & 0xFF));
+
+    if (g_WaitRetrace)
+        while (!(i686_inb(VGA_INPUT_STATUS_PORT) & VGA_STATUS_VRETRACE));
+
+    g_FrontPage = page;
+    g_ScreenBuffer = VGA_page(g_FrontPage);
+    g_BackBuffer = VGA_page(VGA_backpage());
+    VGA_setcursor(g_ScreenX, g_ScreenY);
+}
@@ -1,4 +1,16 @@
 #pragma once
+#include <stdint.h>
+#include <stdbool.h>
 
 void VGA_clrscr();
 void VGA_putc(char c);
+
+void VGA_putchr(int x, int y, char c);
+void VGA_putcolor(int x, int y, uint8_t color);
+void VGA_putcell(int x, int y, uint16_t cell);
+
+void VGA_setpages(int count);
+int VGA_backpage();
+const uint16_t* VGA_pagecells(int page);
+void VGA_setvsync(bool wait);
+void VGA_flip();
@@ -4,6 +4,7 @@
 #include <hal/hal.h>
 #include <arch/i686/irq.h>
 #include <debug.h>
+#include <random.h>
 #include <pacman/engine.h>
 
 extern uint8_t __bss_start;
@@ -21,6 +22,7 @@ void __attribute__((section(".entry"))) start(uint16_t bootDrive)
     memset(&__bss_start, 0, (&__end) - (&__bss_start));
 
     HAL_Initialize();
+    Random_Initialize();
 
     log_debug("Main", "This is a debug msg!");
     log_info("Main", "This is an info msg!");
@@ -0,0 +1,181 @@
+#include "actors.h"
+#include "maze.h"
+#include "render.h"
+
+ActorTable g_Actors;
+
+// Only the cells with a ghost on them have bits set
+void Actors_Clear()
+{
+    for (int i = ACTOR_FIRST_GHOST; i < g_Actors.Count; i++)
+        g_Actors.GhostMask[g_Actors.Cell[i]] = 0;
+    g_Actors.Count = 0;
+}
+
+int Actors_Add(uint16_t cell, uint8_t color, uint8_t symbol)
+{
+    if (g_Actors.Count == ACTOR_MAX)
+        return -1;
+
+    int actor = g_Actors.Count++;
+    g_Actors.Cell[actor] = cell;
+    g_Actors.LastCell[actor] = cell;
+    g_Actors.Spawn[actor] = cell;
+    g_Actors.Prev[actor] = cell;
+    g_Actors.Color[actor] = color;
+    g_Actors.Symbol[actor] = symbol;
+    if (actor >= ACTOR_FIRST_GHOST)
+        g_Actors.GhostMask[cell] |= ACTOR_GHOST_BIT(actor);
+    return actor;
+}
+
+// Rows plus columns, the tunnel doesn't count
+static bool Near(uint16_t cell, uint16_t away, int radius)
+{
+    int dx = MAZE_X(cell) - MAZE_X(away), dy = MAZE_Y(cell) - MAZE_Y(away);
+    return (dx < 0 ? -dx : dx) + (dy < 0 ? -dy : dy) < radius;
+}
+
+void Actors_Spread(int count, uint16_t away, int radius, uint8_t symbol, const uint8_t* colors, int colorCount)
+{
+    uint32_t walkable = 0, k = 0;
+    int added = 0;
+
+    for (int cell = 0; cell < MAZE_CELLS; cell++)
+        if (Maze_Tile(cell) != TILE_WALL && !Near(cell, away, radius))
+            walkable++;
+    // a maze too small for the radius gets its actors all the same
+    if (walkable == 0 && radius > 0) {
+        Actors_Spread(count, away, 0, symbol, colors, colorCount);
+        return;
+    }
+
+    // the k-th cell far enough gets an actor where k * count / walkable
+    // steps up, that is count cells at even distances
+    for (int cell = 0; cell < MAZE_CELLS && walkable != 0; cell++) {
+        if (Maze_Tile(cell) == TILE_WALL || Near(cell, away, radius))
+            continue;
+        if ((k + 1) * count / walkable != k * count / walkable)
+            Actors_Add(cell, colors[added++ % colorCount], symbol);
+        k++;
+    }
+}
+
+void Actors_Save(ActorState* state)
+{
+    state->Count = g_Actors.Count;
+    for (int i = 0; i < g_Actors.Count; i++) {
+        state->Cell[i] = g_Actors.Cell[i];
+        state->LastCell[i] = g_Actors.LastCell[i];
+        state->Spawn[i] = g_Actors.Spawn[i];
+        state->Prev[i] = g_Actors.Prev[i];
+        state->Color[i] = g_Actors.Color[i];
+        state->Symbol[i] = g_Actors.Symbol[i];
+    }
+}
+
+void Actors_Load(const ActorState* state)
+{
+    Actors_Clear();
+    g_Actors.Count = state->Count;
+    for (int i = 0; i < state->Count; i++) {
+        g_Actors.Cell[i] = state->Cell[i];
+        g_Actors.LastCell[i] = state->LastCell[i];
+        g_Actors.Spawn[i] = state->Spawn[i];
+        g_Actors.Prev[i] = state->Prev[i];
+        g_Actors.Color[i] = state->Color[i];
+        g_Actors.Symbol[i] = state->Symbol[i];
+        if (i >= ACTOR_FIRST_GHOST)
+            g_Actors.GhostMask[state->Cell[i]] |= ACTOR_GHOST_BIT(i);
+    }
+}
+
+void Actors_Snapshot()
+{
+    for (int i = 0; i < g_Actors.Count; i++)
+        g_Actors.Prev[i] = g_Actors.Cell[i];
+}
+
+void Actors_Position(int actor, uint32_t alpha, int32_t* x, int32_t* y)
+{
+    int32_t cx = MAZE_X(g_Actors.Cell[actor]), cy = MAZE_Y(g_Actors.Cell[actor]);
+    int32_t dx = cx - MAZE_X(g_Actors.Prev[actor]), dy = cy - MAZE_Y(g_Actors.Prev[actor]);
+
+    *x = cx << ACTOR_SUBCELL_BITS;
+    *y = cy << ACTOR_SUBCELL_BITS;
+    if (dx * dx + dy * dy == 1) {
+        // back from the current cell by the part of the move still to come
+        int32_t rest = ACTOR_SUBCELL_ONE - (int32_t)alpha;
+        *x -= dx * rest;
+        *y -= dy * rest;
+    }
+}
+
+void Actors_Draw(uint32_t alpha, int originX, int originY)
+{
+    int32_t x, y;
+
+    // backwards, so pacman is drawn last and covers a ghost on the same cell
+    for (int i = g_Actors.Count - 1; i >= 0; i--) {
+        Actors_Position(i, alpha, &x, &y);
+        Render_DrawSprite(((x + ACTOR_SUBCELL_ONE / 2) >> ACTOR_SUBCELL_BITS) - originX,
+            ((y + ACTOR_SUBCELL_ONE / 2) >> ACTOR_SUBCELL_BITS) - originY,
+            RENDER_CELL(g_Actors.Symbol[i], g_Actors.Color[i]));
+    }
+}
+
+// The start of a span of the given size around center, inside 0..limit
+static int Around(int center, int size, int limit)
+{
+    int start = center - size / 2;
+    if (start > limit - size)
+        start = limit - size;
+    return start < 0 ? 0 : start;
+}
+
+void Actors_ActiveRect(MazeRect* rect)
+{
+    uint16_t pacman = g_Actors.Cell[ACTOR_PACMAN];
+
+    rect->Width = NUM_COLS < ACTOR_ACTIVE_COLS ? NUM_COLS : ACTOR_ACTIVE_COLS;
+    rect->Height = NUM_ROWS < ACTOR_ACTIVE_ROWS ? NUM_ROWS : ACTOR_ACTIVE_ROWS;
+    rect->X = Around(MAZE_X(pacman), rect->Width, NUM_COLS);
+    rect->Y = Around(MAZE_Y(pacman), rect->Height, NUM_ROWS);
+}
+
+static void Place(int actor, uint16_t cell)
+{
+    if (actor >= ACTOR_FIRST_GHOST) {
+        uint64_t bit = ACTOR_GHOST_BIT(actor);
+        g_Actors.GhostMask[g_Actors.Cell[actor]] &= ~bit;
+        g_Actors.GhostMask[cell] |= bit;
+    }
+    g_Actors.Cell[actor] = cell;
+}
+
+void Actor_Move(int actor, Direction direction)
+{
+    uint16_t cell = g_Actors.Cell[actor];
+    uint16_t next = Maze_Neighbor(cell, direction);
+    g_Actors.LastCell[actor] = next != cell ? cell : g_Actors.LastCell[actor];
+    Place(actor, next);
+}
+
+void Actor_Respawn(int actor)
+{
+    Place(actor, g_Actors.Spawn[actor]);
+    g_Actors.LastCell[actor] = g_Actors.Spawn[actor];
+}
+
+uint8_t Actor_BackExit(int actor)
+{
+    uint16_t cell = g_Actors.Cell[actor];
+    uint16_t last = g_Actors.LastCell[actor];
+    if (last == cell)
+        return 0;
+
+    for (int d = left; d <= down; d++)
+        if (Maze_Neighbor(cell, d) == last)
+            return MAZE_EXIT(d);
+    return 0;
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include "layout.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+// Pacman is always the first actor, the ghosts follow
+#define ACTOR_PACMAN            0
+#define ACTOR_FIRST_GHOST       1
+
+#ifndef ACTOR_MAX_GHOSTS
+#define ACTOR_MAX_GHOSTS        64
+#endif
+#define ACTOR_MAX               (ACTOR_FIRST_GHOST + ACTOR_MAX_GHOSTS)
+
+#if ACTOR_MAX_GHOSTS > 64
+#error "The ghost masks of the occupancy grid have 64 bits"
+#endif
+
+// Sub-cell positions are fixed point with 8 fraction bits
+#define ACTOR_SUBCELL_BITS      8
+#define ACTOR_SUBCELL_ONE       (1 << ACTOR_SUBCELL_BITS)
+
+// On a large maze only the actors around pacman move: those within the
+// screen's size plus a margin each way, centered on him. Further away
+// they sleep, so a tick's work doesn't grow with the maze.
+#define ACTOR_ACTIVE_COLS       (RENDER_COLS + 32)
+#define ACTOR_ACTIVE_ROWS       (RENDER_ROWS + 16)
+
+// The bit of a ghost in the occupancy grid
+#define ACTOR_GHOST_BIT(actor)  (1ull << ((actor) - ACTOR_FIRST_GHOST))
+
+// All the actors, one array per field, so a pass over one field of every
+// actor walks a packed array instead of striding over whole structs
+typedef struct {
+    uint16_t Count;
+    uint16_t Cell[ACTOR_MAX];       // index into the maze
+    uint16_t LastCell[ACTOR_MAX];   // the cell before the last move, to prefer going forward rather than back
+    uint16_t Spawn[ACTOR_MAX];      // where the actor comes back after a collision
+    uint16_t Prev[ACTOR_MAX];       // the cell at the previous simulation step, the frames in between interpolate from it
+    uint8_t Color[ACTOR_MAX];
+    uint8_t Symbol[ACTOR_MAX];
+
+    // The occupancy grid: the ghosts on each cell, kept up to date by every move
+    uint64_t GhostMask[MAZE_CELLS];
+} ActorTable;
+
+extern ActorTable g_Actors;
+
+// The actor table without the occupancy grid, which follows from the cells
+typedef struct {
+    uint16_t Count;
+    uint16_t Cell[ACTOR_MAX];
+    uint16_t LastCell[ACTOR_MAX];
+    uint16_t Spawn[ACTOR_MAX];
+    uint16_t Prev[ACTOR_MAX];
+    uint8_t Color[ACTOR_MAX];
+    uint8_t Symbol[ACTOR_MAX];
+} ActorState;
+
+void Actors_Clear();
+
+// Returns the actor's index, -1 if the table is full
+int Actors_Add(uint16_t cell, uint8_t color, uint8_t symbol);
+
+// Adds the actors evenly spread over the walkable cells at least radius
+// rows plus columns away from the cell away, taking the colors in turn
+void Actors_Spread(int count, uint16_t away, int radius, uint8_t symbol, const uint8_t* colors, int colorCount);
+
+// Copies the actors out, and back in with the occupancy grid rebuilt
+void Actors_Save(ActorState* state);
+void Actors_Load(const ActorState* state);
+
+// Remembers the current cells as the previous simulation step's
+void Actors_Snapshot();
+
+// Where the actor is alpha (out of ACTOR_SUBCELL_ONE) of the way from its
+// previous cell to its current one, in fixed point columns and rows.
+// Jumps further than a cell (respawns, the tunnel) aren't interpolated.
+void Actors_Position(int actor, uint32_t alpha, int32_t* x, int32_t* y);
+
+// Puts every actor on the screen as a sprite, pacman on top, each on the
+// cell nearest to its interpolated position. The maze cell at originX,
+// originY is the top left corner of the screen.
+void Actors_Draw(uint32_t alpha, int originX, int originY);
+
+// The cells where the actors are awake, all of the maze unless it's large
+void Actors_ActiveRect(MazeRect* rect);
+
+// Blocked directions lead back to the same cell, so no wall checks here
+void Actor_Move(int actor, Direction direction);
+
+// Puts the actor back on its spawn point
+void Actor_Respawn(int actor);
+
+// The exit leading back to where the actor came from, 0 if it didn't move yet
+uint8_t Actor_BackExit(int actor);
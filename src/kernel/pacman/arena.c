@@ -0,0 +1,32 @@
+#include "arena.h"
+#include <stddef.h>
+
+static uint8_t g_Arena[ARENA_SIZE] __attribute__((aligned(ARENA_ALIGN)));
+static ArenaStats g_Stats;
+
+void Arena_Reset()
+{
+    g_Stats.Frames++;
+    g_Stats.Used = 0;
+}
+
+void* Arena_Alloc(uint32_t size)
+{
+    uint32_t rounded = (size + ARENA_ALIGN - 1) & ~(uint32_t)(ARENA_ALIGN - 1);
+
+    if (rounded < size || rounded > ARENA_SIZE - g_Stats.Used) {
+        g_Stats.Failed++;
+        return NULL;
+    }
+
+    void* block = &g_Arena[g_Stats.Used];
+    g_Stats.Used += rounded;
+    if (g_Stats.Used > g_Stats.HighWater)
+        g_Stats.HighWater = g_Stats.Used;
+    return block;
+}
+
+const ArenaStats* Arena_GetStats()
+{
+    return &g_Stats;
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <stdint.h>
+
+// Scratch memory for the length of a frame, bumped off a reservation in
+// .bss and given back all at once when the next frame starts: MainLoop()
+// and NetplayLoop() reset it at the top of every pass, Game_Step() before
+// its tick. Nothing from it may be kept across frames. The collision
+// events take the first share of every frame, the autopilot's pellet
+// sources on a large maze what is left. Make ARENA=n bytes sizes the
+// reservation for stress levels.
+#ifndef ARENA_SIZE
+#define ARENA_SIZE              16384
+#endif
+
+#define ARENA_ALIGN             8
+
+typedef struct {
+    uint32_t Frames;        // resets
+    uint32_t Used;          // by the current frame
+    uint32_t HighWater;     // the most a frame used
+    uint32_t Failed;        // allocations that didn't fit
+} ArenaStats;
+
+// Gives back everything allocated since the last reset
+void Arena_Reset();
+
+// size bytes aligned to ARENA_ALIGN, NULL when the frame's share is used up
+void* Arena_Alloc(uint32_t size);
+
+const ArenaStats* Arena_GetStats();
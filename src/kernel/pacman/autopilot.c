@@ -0,0 +1,148 @@
+#include "autopilot.h"
+#include "actors.h"
+#include "maze.h"
+#include "distance.h"
+#include "pellets.h"
+#include "game.h"
+#include "arena.h"
+#include <arch/i686/tsc.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SCANCODE_EXTENDED       0xE0
+#define SCANCODE_RELEASED       0x80
+#define AUTOPILOT_STAY          4   // no key this tick
+
+static const uint8_t g_Arrows[] = { 0x4B, 0x4D, 0x48, 0x50 };    // left, right, up, down
+
+// The way to the nearest pellet from every cell, one BFS from all of them at once
+static DistanceField g_PelletDistance;
+static int g_LastDirection;
+
+#if MAZE_LARGE
+// On a large maze the search starts from the pellets around pacman. Only
+// with none of them in reach the whole maze is searched, once per pellet
+// eaten: the field stays good until one is.
+static uint32_t g_WholeMazeRemaining;   // the pellets left at the last whole search, -1 for none
+#endif
+
+// A ghost on the cell or next to it can step on pacman in the same tick
+static bool Dangerous(uint16_t cell)
+{
+    if (g_Actors.GhostMask[cell] != 0)
+        return true;
+
+    uint8_t exits = Maze_Exits(cell);
+    for (int d = left; d <= down; d++)
+        if ((exits & MAZE_EXIT(d)) && g_Actors.GhostMask[Maze_Neighbor(cell, d)] != 0)
+            return true;
+    return false;
+}
+
+static void Autopilot_Initialize()
+{
+    g_LastDirection = AUTOPILOT_STAY;
+#if MAZE_LARGE
+    Distance_Clear(&g_PelletDistance);
+    g_WholeMazeRemaining = (uint32_t)-1;
+#endif
+}
+
+static void Autopilot_Shutdown()
+{
+}
+
+// The safe exit closest to a pellet, the same direction as before on a tie.
+// Staying only wins when every way out is dangerous.
+static int Decide(uint16_t cell)
+{
+    bool powered = Game_IsPowered();
+    uint8_t exits = Maze_Exits(cell);
+    int best = AUTOPILOT_STAY;
+    bool bestDanger = !powered && Dangerous(cell);
+    uint32_t bestDistance = DISTANCE_UNREACHABLE + 1;   // any move beats staying put
+
+    for (int i = 0; i < 4; i++) {
+        // the last direction goes first, so it keeps ties
+        int d = g_LastDirection == AUTOPILOT_STAY ? i : (g_LastDirection + i) & 3;
+        if (!(exits & MAZE_EXIT(d)))
+            continue;
+
+        uint16_t next = Maze_Neighbor(cell, d);
+        bool danger = !powered && Dangerous(next);
+        uint32_t distance = g_PelletDistance.Distance[next];
+        if (danger < bestDanger || (danger == bestDanger && distance < bestDistance)) {
+            best = d;
+            bestDanger = danger;
+            bestDistance = distance;
+        }
+    }
+    return best;
+}
+
+static void FindPellets(uint16_t pacman)
+{
+    // static, a large maze's bitboards don't fit on the kernel stack
+    static Bitboard pellets;
+
+#if MAZE_LARGE
+    MazeRect active;
+    int count = 0;
+
+    // the frame's scratch, without it the whole maze is searched
+    uint16_t* sources = Arena_Alloc(ACTOR_ACTIVE_COLS * ACTOR_ACTIVE_ROWS * sizeof(uint16_t));
+
+    Actors_ActiveRect(&active);
+    for (int y = active.Y; sources != NULL && y < active.Y + active.Height; y++) {
+        for (int x = active.X; x < active.X + active.Width; x++) {
+            Tile tile = Maze_Tile(MAZE_INDEX(x, y));
+            if (tile == TILE_DOT || tile == TILE_POWER)
+                sources[count++] = MAZE_INDEX(x, y);
+        }
+    }
+
+    if (count > 0 && g_WholeMazeRemaining != g_Pellets.Remaining) {
+        Distance_FromCellsInRect(&g_PelletDistance, sources, count, &active);
+        if (g_PelletDistance.Distance[pacman] != DISTANCE_UNREACHABLE) {
+            g_WholeMazeRemaining = (uint32_t)-1;
+            return;
+        }
+    }
+    if (g_WholeMazeRemaining == g_Pellets.Remaining)
+        return;
+    g_WholeMazeRemaining = g_Pellets.Remaining;
+#endif
+
+    Bitboard_Or(&pellets, &g_Pellets.Dots, &g_Pellets.Powers);
+    Distance_FromSet(&g_PelletDistance, &pellets);
+}
+
+static void Autopilot_Poll(uint32_t tick)
+{
+    FindPellets(g_Actors.Cell[ACTOR_PACMAN]);
+
+    int direction = Decide(g_Actors.Cell[ACTOR_PACMAN]);
+    g_LastDirection = direction;
+    if (direction == AUTOPILOT_STAY)
+        return;
+
+    // a press and a release, the way the keyboard IRQ delivers them
+    uint8_t arrow = g_Arrows[direction];
+    Input_OnScancode(SCANCODE_EXTENDED, i686_rdtsc());
+    Input_OnScancode(arrow, i686_rdtsc());
+    Input_OnScancode(SCANCODE_EXTENDED, i686_rdtsc());
+    Input_OnScancode(arrow | SCANCODE_RELEASED, i686_rdtsc());
+}
+
+static const InputDriver g_AutopilotDriver = {
+    .Name = "autopilot",
+    .Initialize = &Autopilot_Initialize,
+    .Shutdown = &Autopilot_Shutdown,
+    .Poll = &Autopilot_Poll,
+};
+
+const InputDriver* Autopilot_GetDriver()
+{
+    return &g_AutopilotDriver;
+}
@@ -0,0 +1,7 @@
+#pragma once
+#include "input.h"
+
+// Plays the game on its own for soak runs: heads for the nearest pellet and
+// keeps a cell between pacman and the ghosts. It presses the arrow keys the
+// way the keyboard IRQ does, so the game can't tell it from a player.
+const InputDriver* Autopilot_GetDriver();
@@ -0,0 +1,309 @@
+#include "bench.h"
+#include "maze.h"
+#include "distance.h"
+#include "actors.h"
+#include "ghosts.h"
+#include "pellets.h"
+#include "level.h"
+#include "maze_gen.h"
+#include <arch/i686/tsc.h>
+#include <arch/i686/rdrand.h>
+#include <debug.h>
+#include <util/math.h>
+#include <util/coroutine.h>
+#include <random.h>
+#include <stdint.h>
+
+#define MODULE                  "BENCH"
+#define BENCH_ROUNDS            16
+#define BENCH_TICKS             256
+#define BENCH_DRAWS             4096
+#define BENCH_MAZES             64
+#define BENCH_PHASE_TICKS       28, 80, 40  // the parts of the ghost scripts
+
+// Distance fields from a sample of the cells of a large maze, a field of it costs too much for all
+#if MAZE_LARGE
+#define BENCH_DISTANCE_STRIDE   1021
+#else
+#define BENCH_DISTANCE_STRIDE   1
+#endif
+
+static DistanceField g_Field;
+static DistanceField g_Reference;
+
+// Distance fields from every walkable cell, bit-parallel against the queue-based BFS
+static void Bench_Distance()
+{
+    uint64_t bitboardCycles = 0, scalarCycles = 0;
+    uint32_t fields = 0, mismatches = 0, diameter = 0;
+
+    for (int round = 0; round < BENCH_ROUNDS; round++) {
+        for (int cell = 0; cell < MAZE_CELLS; cell += BENCH_DISTANCE_STRIDE) {
+            if (Maze_Tile(cell) == TILE_WALL)
+                continue;
+
+            uint64_t start = i686_rdtsc();
+            Distance_FromCell(&g_Field, cell);
+            uint64_t middle = i686_rdtsc();
+            Distance_FromCellScalar(&g_Reference, cell);
+            uint64_t end = i686_rdtsc();
+
+            bitboardCycles += middle - start;
+            scalarCycles += end - middle;
+            fields++;
+
+            for (int i = 0; i < MAZE_CELLS; i++)
+                if (g_Field.Distance[i] != g_Reference.Distance[i]) {
+                    mismatches++;
+                    break;
+                }
+            if (g_Field.Layers > diameter)
+                diameter = g_Field.Layers;
+        }
+    }
+
+    log_info(MODULE, "distance field: %u fields, max %u layers, %u mismatches", fields, diameter, mismatches);
+    log_info(MODULE, "distance field: bitboard flood fill %u cycles/field, scalar BFS %u cycles/field",
+        div64_32(bitboardCycles, fields), div64_32(scalarCycles, fields));
+}
+
+// The cost of a tick against the number of ghosts, the update and the draw pass
+// separately. The game's actors are put back afterwards.
+static void Bench_Ghosts()
+{
+    static const uint16_t counts[] = { 1, 4, 16, 64, ACTOR_MAX_GHOSTS };
+    static ActorTable saved;
+
+    saved = g_Actors;
+    for (int c = 0; c < sizeof(counts) / sizeof(counts[0]); c++) {
+        if (counts[c] > ACTOR_MAX_GHOSTS || (c > 0 && counts[c] == counts[c - 1]))
+            continue;
+
+        Actors_Clear();
+        Actors_Add(saved.Cell[ACTOR_PACMAN], saved.Color[ACTOR_PACMAN], saved.Symbol[ACTOR_PACMAN]);
+        Actors_Spread(counts[c], saved.Cell[ACTOR_PACMAN], 0, 'G', &saved.Color[ACTOR_PACMAN], 1);
+
+        uint64_t updateCycles = 0, drawCycles = 0;
+        for (int tick = 0; tick < BENCH_TICKS; tick++) {
+            uint64_t start = i686_rdtsc();
+            Ghosts_Update();
+            uint64_t middle = i686_rdtsc();
+            Actors_Draw(ACTOR_SUBCELL_ONE, 0, 0);
+            uint64_t end = i686_rdtsc();
+
+            updateCycles += middle - start;
+            drawCycles += end - middle;
+        }
+
+        uint32_t ghosts = g_Actors.Count - ACTOR_FIRST_GHOST;
+        log_info(MODULE, "ghosts: %u ghosts, update %u cycles/tick (%u/ghost), draw %u cycles/tick",
+            ghosts, div64_32(updateCycles, BENCH_TICKS), div64_32(updateCycles, BENCH_TICKS * ghosts),
+            div64_32(drawCycles, BENCH_TICKS));
+    }
+    g_Actors = saved;
+}
+
+// Cycles per draw of the generator against the hardware it replaced
+static void Bench_Random()
+{
+    uint32_t sink = 0, value;
+    uint64_t start, cycles;
+
+    start = i686_rdtsc();
+    for (int i = 0; i < BENCH_DRAWS; i++)
+        sink += Random_Next();
+    cycles = i686_rdtsc() - start;
+    log_info(MODULE, "random: Random_Next %u cycles/draw", div64_32(cycles, BENCH_DRAWS));
+
+    start = i686_rdtsc();
+    for (int i = 0; i < BENCH_DRAWS; i++)
+        sink += Random_Below(3);
+    cycles = i686_rdtsc() - start;
+    log_info(MODULE, "random: Random_Below(3) %u cycles/draw", div64_32(cycles, BENCH_DRAWS));
+
+    start = i686_rdtsc();
+    for (int i = 0; i < BENCH_DRAWS; i++)
+        sink += Random_Entropy();
+    cycles = i686_rdtsc() - start;
+    log_info(MODULE, "random: Random_Entropy %u cycles/draw, pool of %u words", div64_32(cycles, BENCH_DRAWS), RANDOM_POOL_WORDS);
+
+    if (i686_HasRdrand()) {
+        uint32_t failed = 0;
+        start = i686_rdtsc();
+        for (int i = 0; i < BENCH_DRAWS; i++) {
+            failed += !i686_Rdrand(&value);
+            sink += value;
+        }
+        cycles = i686_rdtsc() - start;
+        log_info(MODULE, "random: rdrand %u cycles/draw, %u failed", div64_32(cycles, BENCH_DRAWS), failed);
+    }
+
+    if (i686_HasRdseed()) {
+        uint32_t failed = 0;
+        start = i686_rdtsc();
+        for (int i = 0; i < BENCH_DRAWS; i++) {
+            failed += !i686_Rdseed(&value);
+            sink += value;
+        }
+        cycles = i686_rdtsc() - start;
+        log_info(MODULE, "random: rdseed %u cycles/draw, %u failed", div64_32(cycles, BENCH_DRAWS), failed);
+    }
+
+    const RandomStats* stats = Random_GetStats();
+    log_info(MODULE, "random: %u refills, %u rdseed, %u rdrand, %u tsc words, %u retries (%x)",
+        stats->Refills, stats->RdseedWords, stats->RdrandWords, stats->TscWords, stats->Retries, sink);
+}
+
+// The pellet bookkeeping: loading the bitsets, eating every cell of the maze
+// once and the level-complete check. Leaves the maze without pellets.
+static void Bench_Pellets()
+{
+    uint64_t loadCycles = 0, eatCycles = 0, checkCycles = 0;
+    uint32_t eats = 0, eaten = 0, cleared = 0;
+
+    for (int round = 0; round < BENCH_ROUNDS; round++) {
+        Maze_Load(&g_LevelLandscape[0][0], LEVEL_ROWS, LEVEL_COLS);
+
+        uint64_t start = i686_rdtsc();
+        Pellets_Load();
+        loadCycles += i686_rdtsc() - start;
+
+        for (int cell = 0; cell < MAZE_CELLS; cell++) {
+            if (Maze_Tile(cell) == TILE_WALL)
+                continue;
+
+            start = i686_rdtsc();
+            eaten += Pellets_Eat(cell) != TILE_PATH;
+            uint64_t middle = i686_rdtsc();
+            cleared += Pellets_Cleared();
+            uint64_t end = i686_rdtsc();
+
+            eatCycles += middle - start;
+            checkCycles += end - middle;
+            eats++;
+        }
+    }
+
+    log_info(MODULE, "pellets: load %u cycles, eat %u cycles/cell, level check %u cycles",
+        div64_32(loadCycles, BENCH_ROUNDS), div64_32(eatCycles, eats), div64_32(checkCycles, eats));
+    log_info(MODULE, "pellets: %u eaten in %u rounds, cleared %u times", eaten, BENCH_ROUNDS, cleared);
+}
+
+// Mazes from consecutive seeds, the whole generator against its union-find check
+static void Bench_MazeGen()
+{
+    static uint8_t landscape[NUM_ROWS * NUM_COLS];
+    uint64_t generateCycles = 0, validateCycles = 0;
+    uint32_t attempts = 0, failed = 0, pellets = 0;
+    MazeGenStats stats;
+
+    for (int i = 0; i < BENCH_MAZES; i++) {
+        uint64_t start = i686_rdtsc();
+        bool generated = MazeGen_Generate(i, landscape, &stats);
+        uint64_t middle = i686_rdtsc();
+        MazeGen_Validate(landscape, &stats);
+        uint64_t end = i686_rdtsc();
+
+        generateCycles += middle - start;
+        validateCycles += end - middle;
+        attempts += stats.Attempts;
+        failed += !generated;
+        pellets += stats.Pellets;
+    }
+
+    log_info(MODULE, "mazegen: %u cycles/maze, validation %u cycles, %u mazes",
+        div64_32(generateCycles, BENCH_MAZES), div64_32(validateCycles, BENCH_MAZES), BENCH_MAZES);
+    log_info(MODULE, "mazegen: %u attempts, %u pellets, %u failed", attempts, pellets / BENCH_MAZES, failed);
+}
+
+// The shape of the ghost scripts with next to no work in it: once as a
+// coroutine resumed through its switch, once as the plain function it
+// replaced, keeping its place in a phase of its own
+typedef struct {
+    Coroutine Co;
+    uint16_t Phase;
+    uint16_t Ticks;
+} BenchScript;
+
+static const uint16_t g_PhaseTicks[] = { BENCH_PHASE_TICKS };
+static BenchScript g_Scripts[ACTOR_MAX];
+static uint32_t g_ScriptWork;
+
+static void __attribute__((noinline)) ResumeScript(int actor)
+{
+    BenchScript* script = &g_Scripts[actor];
+
+    CO_BEGIN(&script->Co);
+    for (;;) {
+        for (script->Ticks = 0; script->Ticks < g_PhaseTicks[0]; script->Ticks++) {
+            g_ScriptWork += actor;
+            CO_YIELD(&script->Co);
+        }
+        for (script->Ticks = 0; script->Ticks < g_PhaseTicks[1]; script->Ticks++) {
+            g_ScriptWork ^= actor;
+            CO_YIELD(&script->Co);
+        }
+        for (script->Ticks = 0; script->Ticks < g_PhaseTicks[2]; script->Ticks++) {
+            g_ScriptWork -= actor;
+            CO_YIELD(&script->Co);
+        }
+    }
+    CO_END(&script->Co);
+}
+
+static void __attribute__((noinline)) CallStep(int actor)
+{
+    BenchScript* script = &g_Scripts[actor];
+
+    switch (script->Phase) {
+    case 0: g_ScriptWork += actor; break;
+    case 1: g_ScriptWork ^= actor; break;
+    default: g_ScriptWork -= actor; break;
+    }
+    if (++script->Ticks == g_PhaseTicks[script->Phase]) {
+        script->Ticks = 0;
+        script->Phase = script->Phase == 2 ? 0 : script->Phase + 1;
+    }
+}
+
+// A resume of every actor's script per tick against a call of its step
+static void Bench_Coroutines()
+{
+    uint64_t resumeCycles = 0, callCycles = 0;
+    uint32_t resumeWork, steps = BENCH_ROUNDS * BENCH_TICKS * ACTOR_MAX;
+
+    for (int i = 0; i < ACTOR_MAX; i++)
+        g_Scripts[i] = (BenchScript){ 0 };
+    g_ScriptWork = 0;
+    for (int tick = 0; tick < BENCH_ROUNDS * BENCH_TICKS; tick++) {
+        uint64_t start = i686_rdtsc();
+        for (int i = 0; i < ACTOR_MAX; i++)
+            ResumeScript(i);
+        resumeCycles += i686_rdtsc() - start;
+    }
+    resumeWork = g_ScriptWork;
+
+    g_ScriptWork = 0;
+    for (int tick = 0; tick < BENCH_ROUNDS * BENCH_TICKS; tick++) {
+        uint64_t start = i686_rdtsc();
+        for (int i = 0; i < ACTOR_MAX; i++)
+            CallStep(i);
+        callCycles += i686_rdtsc() - start;
+    }
+
+    // in tenths of a cycle, a step is only a few
+    uint32_t resume = div64_32(resumeCycles * 10, steps), call = div64_32(callCycles * 10, steps);
+    log_info(MODULE, "coroutines: %u steps, resume %u.%u cycles/step, plain call %u.%u cycles/step, %s",
+        steps, resume / 10, resume % 10, call / 10, call % 10, resumeWork == g_ScriptWork ? "same work" : "work differs");
+    log_info(MODULE, "coroutines: %u bytes of script state a ghost, no stack", sizeof(GhostScript));
+}
+
+void Bench_Run()
+{
+    Bench_Random();
+    Bench_Distance();
+    Bench_Ghosts();
+    Bench_Pellets();
+    Bench_MazeGen();
+    Bench_Coroutines();
+}
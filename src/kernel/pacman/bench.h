@@ -0,0 +1,4 @@
+#pragma once
+
+// Micro benchmarks of the engine, reported on the debug port
+void Bench_Run();
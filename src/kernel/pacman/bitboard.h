@@ -0,0 +1,105 @@
+#pragma once
+#include "layout.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+// One bit per maze cell, in rows whatever order the maze keeps its cells in.
+// A row of up to 32 cells is padded to 32 bits, so a word holds two rows:
+// moving left or right is a shift by 1 inside the word and moving up or down
+// is a shift by 32 into the other half or into the neighbor word.
+// Wider rows are padded to whole words, BITBOARD_ROW_WORDS of them, and
+// moving up or down is moving by that many words.
+#if NUM_COLS <= 32
+#define BITBOARD_ROW_BITS       32
+#else
+#define BITBOARD_ROW_BITS       ((NUM_COLS + 63) / 64 * 64)
+#endif
+#define BITBOARD_ROW_WORDS      (BITBOARD_ROW_BITS / 64)    // 0 for two rows per word
+#define BITBOARD_WORDS          ((NUM_ROWS * BITBOARD_ROW_BITS + 63) / 64)
+#define BITBOARD_BIT(index)     ((MAZE_Y(index) * BITBOARD_ROW_BITS) + MAZE_X(index))
+
+typedef struct {
+    uint64_t Words[BITBOARD_WORDS];
+} Bitboard;
+
+static inline void Bitboard_Clear(Bitboard* bb)
+{
+    for (int i = 0; i < BITBOARD_WORDS; i++)
+        bb->Words[i] = 0;
+}
+
+static inline void Bitboard_Set(Bitboard* bb, int index)
+{
+    int bit = BITBOARD_BIT(index);
+    bb->Words[bit >> 6] |= 1ull << (bit & 63);
+}
+
+static inline void Bitboard_Reset(Bitboard* bb, int index)
+{
+    int bit = BITBOARD_BIT(index);
+    bb->Words[bit >> 6] &= ~(1ull << (bit & 63));
+}
+
+static inline bool Bitboard_Test(const Bitboard* bb, int index)
+{
+    int bit = BITBOARD_BIT(index);
+    return (bb->Words[bit >> 6] >> (bit & 63)) & 1;
+}
+
+static inline bool Bitboard_Empty(const Bitboard* bb)
+{
+    uint64_t any = 0;
+    for (int i = 0; i < BITBOARD_WORDS; i++)
+        any |= bb->Words[i];
+    return any == 0;
+}
+
+static inline void Bitboard_And(Bitboard* dst, const Bitboard* a, const Bitboard* b)
+{
+    for (int i = 0; i < BITBOARD_WORDS; i++)
+        dst->Words[i] = a->Words[i] & b->Words[i];
+}
+
+static inline void Bitboard_Or(Bitboard* dst, const Bitboard* a, const Bitboard* b)
+{
+    for (int i = 0; i < BITBOARD_WORDS; i++)
+        dst->Words[i] = a->Words[i] | b->Words[i];
+}
+
+static inline void Bitboard_AndNot(Bitboard* dst, const Bitboard* a, const Bitboard* b)
+{
+    for (int i = 0; i < BITBOARD_WORDS; i++)
+        dst->Words[i] = a->Words[i] & ~b->Words[i];
+}
+
+// Software popcount, __builtin_popcount would need libgcc
+static inline uint32_t Bitboard_Popcount32(uint32_t x)
+{
+    x = x - ((x >> 1) & 0x55555555);
+    x = (x & 0x33333333) + ((x >> 2) & 0x33333333);
+    x = (x + (x >> 4)) & 0x0F0F0F0F;
+    return (x * 0x01010101) >> 24;
+}
+
+static inline uint32_t Bitboard_Count(const Bitboard* bb)
+{
+    uint32_t count = 0;
+    for (int i = 0; i < BITBOARD_WORDS; i++)
+        count += Bitboard_Popcount32((uint32_t)bb->Words[i]) + Bitboard_Popcount32((uint32_t)(bb->Words[i] >> 32));
+    return count;
+}
+
+// Calls the statement for every set bit, with the cell's maze index in the variable
+#define BITBOARD_FOREACH(bb, index, statement)                                  \
+    for (int _w = 0; _w < BITBOARD_WORDS; _w++) {                               \
+        for (int _h = 0; _h < 2; _h++) {                                        \
+            uint32_t _bits = (uint32_t)((bb)->Words[_w] >> (32 * _h));          \
+            while (_bits) {                                                     \
+                int _bit = 64 * _w + 32 * _h + __builtin_ctz(_bits);            \
+                int _row = _bit / BITBOARD_ROW_BITS;                            \
+                int index = MAZE_INDEX(_bit % BITBOARD_ROW_BITS, _row);         \
+                _bits &= _bits - 1;                                             \
+                statement;                                                      \
+            }                                                                   \
+        }                                                                       \
+    }
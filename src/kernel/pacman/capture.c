@@ -0,0 +1,165 @@
+#include "capture.h"
+#include "render.h"
+#include <arch/i686/tsc.h>
+#include <util/math.h>
+#include <stddef.h>
+
+#define CAPTURE_CELLS           (RENDER_ROWS * RENDER_COLS)
+
+// The screen the way the decoder has it after the records sent so far
+static uint16_t g_Reference[CAPTURE_CELLS];
+
+static uint8_t g_Record[CAPTURE_FRAME_BYTES];
+static uint32_t g_Size;
+static uint32_t g_Limit;        // the bytes the next record may take
+static bool g_Key;
+static CaptureSink g_Sink;
+static CaptureStats g_Stats;
+
+static void Put8(uint8_t value)
+{
+    g_Record[g_Size++] = value;
+}
+
+static void Put16(uint16_t value)
+{
+    Put8(value & 0xFF);
+    Put8(value >> 8);
+}
+
+static void Put32(uint32_t value)
+{
+    Put16(value & 0xFFFF);
+    Put16(value >> 16);
+}
+
+static void Put64(uint64_t value)
+{
+    Put32((uint32_t)value);
+    Put32((uint32_t)(value >> 32));
+}
+
+void Capture_Start(CaptureSink sink)
+{
+    for (int i = 0; i < CAPTURE_CELLS; i++)
+        g_Reference[i] = 0;
+    g_Sink = sink;
+    g_Key = true;
+    g_Limit = CAPTURE_FRAME_BYTES;
+
+    g_Stats.Frames = 0;
+    g_Stats.Bytes = 0;
+    g_Stats.Cells = 0;
+    g_Stats.Partial = 0;
+    g_Stats.OverBudget = 0;
+    g_Stats.LastCycles = 0;
+    g_Stats.MaxCycles = 0;
+    g_Stats.TotalCycles = 0;
+}
+
+// The run of count cells from first on, or the part of a literal run that
+// fits in the record. Returns the cells sent, 0 when none fit.
+static int PutRun(const uint16_t* cells, int first, int count, bool repeat)
+{
+    uint32_t room = g_Limit - g_Size;
+    if (room < CAPTURE_RUN_SIZE + 2)
+        return 0;
+    if (!repeat && CAPTURE_RUN_SIZE + 2 * (uint32_t)count > room)
+        count = (room - CAPTURE_RUN_SIZE) / 2;
+
+    Put16(first | (repeat ? CAPTURE_RUN_REPEAT : 0));
+    Put8(count);
+    for (int i = 0; i < (repeat ? 1 : count); i++)
+        Put16(cells[first + i]);
+    for (int i = first; i < first + count; i++)
+        g_Reference[i] = cells[i];
+
+    g_Stats.Cells += count;
+    return count;
+}
+
+// The changed cells in runs of up to CAPTURE_RUN_MAX, three of the same
+// cell or more as a repeat. Returns false when the record ran out of room.
+static bool PutChanges(const uint16_t* cells, uint16_t* runs)
+{
+    for (int i = 0; i < CAPTURE_CELLS; ) {
+        if (cells[i] == g_Reference[i]) {
+            i++;
+            continue;
+        }
+
+        int end = i;
+        while (end < CAPTURE_CELLS && end - i < CAPTURE_RUN_MAX && cells[end] != g_Reference[end])
+            end++;
+
+        while (i < end) {
+            int same = i + 1;
+            while (same < end && cells[same] == cells[i])
+                same++;
+
+            // a literal run goes up to the next three of a kind
+            bool repeat = same - i >= 3;
+            int last = repeat ? same : i;
+            while (!repeat && last < end && !(last + 2 < end && cells[last] == cells[last + 1] && cells[last] == cells[last + 2]))
+                last++;
+
+            int count = last - i, sent = PutRun(cells, i, count, repeat);
+            if (sent > 0)
+                (*runs)++;
+            if (sent < count)
+                return false;
+            i = last;
+        }
+    }
+    return true;
+}
+
+void Capture_Frame(const uint16_t* cells)
+{
+    if (g_Sink == NULL)
+        return;
+
+    uint64_t start = i686_rdtsc();
+    uint16_t runs = 0;
+
+    g_Size = CAPTURE_HEADER_SIZE;
+    bool complete = PutChanges(cells, &runs);
+    uint32_t size = g_Size;
+
+    g_Size = 0;
+    Put8(CAPTURE_MAGIC);
+    Put8((g_Key ? CAPTURE_KEY : 0) | (complete ? 0 : CAPTURE_PARTIAL));
+    Put16(runs);
+    Put32(g_Stats.Frames);
+    Put64(start);
+    Put32(g_Stats.LastCycles);
+
+    g_Sink(g_Record, size);
+    g_Key = false;
+    uint32_t cycles = (uint32_t)(i686_rdtsc() - start);
+
+    g_Stats.Frames++;
+    g_Stats.Bytes += size;
+    g_Stats.Partial += !complete;
+    g_Stats.LastCycles = cycles;
+    g_Stats.TotalCycles += cycles;
+    if (cycles > g_Stats.MaxCycles)
+        g_Stats.MaxCycles = cycles;
+
+    if (cycles > CAPTURE_BUDGET_CYCLES) {
+        g_Stats.OverBudget++;
+        g_Limit = div64_32((uint64_t)g_Limit * CAPTURE_BUDGET_CYCLES, cycles);
+        if (g_Limit < CAPTURE_MIN_BYTES)
+            g_Limit = CAPTURE_MIN_BYTES;
+    }
+    else if (g_Limit < CAPTURE_FRAME_BYTES) {
+        g_Limit += g_Limit / 4;
+        if (g_Limit > CAPTURE_FRAME_BYTES)
+            g_Limit = CAPTURE_FRAME_BYTES;
+    }
+}
+
+const CaptureStats* Capture_GetStats()
+{
+    return &g_Stats;
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+// The screen as it was shown, frame by frame, for looking into rendering
+// glitches and frame times after the fact (make CAPTURE=1, read with
+// build/host/capture_tool). Every frame is a record of the cells that
+// changed since the frame before, stamped with the TSC.
+//
+// Format, little endian, a record per frame:
+//   uint8  CAPTURE_MAGIC
+//   uint8  flags, CAPTURE_KEY and CAPTURE_PARTIAL
+//   uint16 the run count
+//   uint32 the frame number
+//   uint64 the TSC when the capture of the frame started
+//   uint32 the cycles the capture of the frame before took
+//   the runs: uint16 the first cell, CAPTURE_RUN_REPEAT for a repeat,
+//   uint8 the cell count, then that many cells, one for a repeat
+// A cell is VGA's, the character in the low byte, the attribute in the high one.
+#define CAPTURE_MAGIC           0xCF
+#define CAPTURE_HEADER_SIZE     20
+#define CAPTURE_RUN_SIZE        3       // the run without its cells
+#define CAPTURE_RUN_REPEAT      0x8000
+#define CAPTURE_RUN_MAX         255
+
+#define CAPTURE_KEY             0x01    // against a screen of zeros, the decoder starts over
+#define CAPTURE_PARTIAL         0x02    // cells were left for later frames, the record would have been too large
+
+// Records take at most CAPTURE_FRAME_BYTES, fewer while the frames before
+// went over CAPTURE_BUDGET_CYCLES: the byte limit shrinks by as much as
+// the budget was missed by, and grows back a quarter at a time
+#define CAPTURE_FRAME_BYTES     1024
+#define CAPTURE_MIN_BYTES       64
+#define CAPTURE_BUDGET_CYCLES   1000000
+
+// Where the records go, e.g. the debug port
+typedef void (*CaptureSink)(const uint8_t* data, uint32_t size);
+
+typedef struct {
+    uint32_t Frames;
+    uint32_t Bytes;
+    uint32_t Cells;             // changed cells sent
+    uint32_t Partial;           // frames that left cells for later
+    uint32_t OverBudget;        // frames over CAPTURE_BUDGET_CYCLES
+    uint32_t LastCycles;
+    uint32_t MaxCycles;
+    uint64_t TotalCycles;
+} CaptureStats;
+
+// Starts over with a key frame on the next Capture_Frame()
+void Capture_Start(CaptureSink sink);
+
+// Sends the changes of the screen's RENDER_ROWS x RENDER_COLS cells
+void Capture_Frame(const uint16_t* cells);
+
+const CaptureStats* Capture_GetStats();
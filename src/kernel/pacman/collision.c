@@ -0,0 +1,99 @@
+#include "collision.h"
+#include "actors.h"
+#include "arena.h"
+#include <stddef.h>
+
+// Every ghost at most once per kind. CollisionEvent is 8 bytes.
+#define COLLISION_EVENTS        (2 * ACTOR_MAX_GHOSTS)
+
+#if ARENA_SIZE < COLLISION_EVENTS * 8
+#error "The collision events don't fit in the frame arena"
+#endif
+
+static uint16_t g_StartCell[ACTOR_MAX];
+
+// The frame's scratch, taken on the first tick after the arena is reset.
+// The events are consumed within their tick, nothing has to survive it.
+static CollisionEvent* g_Events;
+static uint32_t g_EventsFrame;
+static int g_EventCount;
+static int g_EventNext;
+
+static CollisionStats g_Stats;
+
+void Collision_BeginTick()
+{
+    // the first allocation of the frame, so it can't come up short
+    const ArenaStats* arena = Arena_GetStats();
+    if (g_Events == NULL || g_EventsFrame != arena->Frames) {
+        g_Events = Arena_Alloc(COLLISION_EVENTS * sizeof(CollisionEvent));
+        g_EventsFrame = arena->Frames;
+    }
+
+    for (int i = 0; i < g_Actors.Count; i++)
+        g_StartCell[i] = g_Actors.Cell[i];
+}
+
+static void Push(uint32_t tick, uint16_t cell, int ghost, CollisionKind kind)
+{
+    CollisionEvent* event = &g_Events[g_EventCount++];
+    event->Tick = tick;
+    event->Cell = cell;
+    event->Ghost = ghost;
+    event->Kind = kind;
+}
+
+// The actor index of every bit of a ghost mask, a half at a time
+#define FOREACH_GHOST(mask, ghost, statement)                                   \
+    for (int _h = 0; _h < 2; _h++) {                                            \
+        uint32_t _bits = (uint32_t)((mask) >> (32 * _h));                       \
+        while (_bits) {                                                         \
+            int ghost = ACTOR_FIRST_GHOST + 32 * _h + __builtin_ctz(_bits);     \
+            _bits &= _bits - 1;                                                 \
+            statement;                                                          \
+        }                                                                       \
+    }
+
+void Collision_Detect(uint32_t tick)
+{
+    uint16_t pacman = g_Actors.Cell[ACTOR_PACMAN];
+    uint16_t start = g_StartCell[ACTOR_PACMAN];
+
+    g_Stats.Ticks++;
+    g_Stats.Dropped += g_EventCount - g_EventNext;
+    g_EventCount = 0;
+    g_EventNext = 0;
+
+    uint64_t same = g_Actors.GhostMask[pacman];
+    FOREACH_GHOST(same, ghost, Push(tick, pacman, ghost, COLLISION_SAME_CELL));
+    g_Stats.SameCell += g_EventCount;
+
+    // the ghosts now on pacman's old cell that started on his new one
+    if (start != pacman) {
+        uint64_t back = g_Actors.GhostMask[start];
+        FOREACH_GHOST(back, ghost, {
+            if (g_StartCell[ghost] == pacman) {
+                Push(tick, pacman, ghost, COLLISION_SWAP);
+                g_Stats.Swaps++;
+            }
+        });
+    }
+}
+
+bool Collision_Pop(CollisionEvent* event)
+{
+    if (g_EventNext == g_EventCount)
+        return false;
+    *event = g_Events[g_EventNext++];
+    return true;
+}
+
+void Collision_Flush()
+{
+    g_EventNext = g_EventCount;
+}
+
+const CollisionStats* Collision_GetStats()
+{
+    return &g_Stats;
+}
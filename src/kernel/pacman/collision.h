@@ -0,0 +1,37 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+// Pacman against the ghosts with the occupancy grid of the actor table.
+// All the actors move during a tick, so two kinds of collisions end it:
+typedef enum {
+    COLLISION_SAME_CELL = 0,    // pacman and the ghost end on the same cell
+    COLLISION_SWAP      = 1,    // they crossed on the edge between two cells
+} CollisionKind;
+
+typedef struct {
+    uint32_t Tick;
+    uint16_t Cell;          // pacman's cell
+    uint8_t Ghost;          // the actor index
+    uint8_t Kind;
+} CollisionEvent;
+
+typedef struct {
+    uint32_t Ticks;         // detection passes
+    uint32_t SameCell;
+    uint32_t Swaps;
+    uint32_t Dropped;       // events not consumed before the next pass
+} CollisionStats;
+
+// Remembers where everybody starts the tick, O(actors)
+void Collision_BeginTick();
+
+// Queues the collisions of the tick. Looks only at the ghosts on pacman's
+// cells, so the cost doesn't grow with the number of ghosts elsewhere.
+void Collision_Detect(uint32_t tick);
+
+// Consumer side, for the main loop
+bool Collision_Pop(CollisionEvent* event);
+void Collision_Flush();
+
+const CollisionStats* Collision_GetStats();
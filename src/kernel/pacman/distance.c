@@ -0,0 +1,203 @@
+#include "distance.h"
+#include <stddef.h>
+
+static const MazeRect g_WholeMaze = { 0, 0, NUM_COLS, NUM_ROWS };
+
+// The queue of the scalar searches, every cell goes in at most once
+static uint16_t g_Queue[MAZE_CELLS];
+
+#if BITBOARD_ROW_WORDS == 0
+// All the cells one move away from the frontier, not yet visited.
+// Returns false when there are none.
+static bool Expand(Bitboard* next, const Bitboard* frontier, const Bitboard* visited)
+{
+    const uint64_t* f = frontier->Words;
+    uint64_t any = 0;
+
+    for (int i = 0; i < BITBOARD_WORDS; i++) {
+        uint64_t moved = ((f[i] & g_Maze.Exits[right].Words[i]) << 1)
+                       | ((f[i] & g_Maze.Exits[left].Words[i]) >> 1)
+                       | ((f[i] & g_Maze.Exits[down].Words[i]) << BITBOARD_ROW_BITS)
+                       | ((f[i] & g_Maze.Exits[up].Words[i]) >> BITBOARD_ROW_BITS)
+                       // the tunnel, from the first column to the last one and back
+                       | ((f[i] & g_Maze.WrapLeft.Words[i]) << (NUM_COLS - 1))
+                       | ((f[i] & g_Maze.WrapRight.Words[i]) >> (NUM_COLS - 1));
+
+        // from the lower row of the previous word, from the upper row of the next one
+        if (i > 0)
+            moved |= (f[i - 1] & g_Maze.Exits[down].Words[i - 1]) >> BITBOARD_ROW_BITS;
+        if (i < BITBOARD_WORDS - 1)
+            moved |= (f[i + 1] & g_Maze.Exits[up].Words[i + 1]) << BITBOARD_ROW_BITS;
+
+        // the exit bitboards only lead to walkable cells, no need to mask them
+        next->Words[i] = moved & ~visited->Words[i];
+        any |= next->Words[i];
+    }
+    return any != 0;
+}
+#else
+// The same for rows of whole words: the moves left and right carry over
+// between the words of a row, up and down is the word a row away
+static bool Expand(Bitboard* next, const Bitboard* frontier, const Bitboard* visited)
+{
+    const uint64_t* f = frontier->Words;
+    uint64_t any = 0;
+
+    for (int i = 0; i < BITBOARD_WORDS; i++) {
+        uint64_t moved = ((f[i] & g_Maze.Exits[right].Words[i]) << 1)
+                       | ((f[i] & g_Maze.Exits[left].Words[i]) >> 1);
+
+        // the last bit of a row has no exit right and the first no exit
+        // left (the tunnel has its own bitboards), so nothing carries into
+        // the next row
+        if (i > 0)
+            moved |= (f[i - 1] & g_Maze.Exits[right].Words[i - 1]) >> 63;
+        if (i < BITBOARD_WORDS - 1)
+            moved |= (f[i + 1] & g_Maze.Exits[left].Words[i + 1]) << 63;
+        if (i >= BITBOARD_ROW_WORDS)
+            moved |= f[i - BITBOARD_ROW_WORDS] & g_Maze.Exits[down].Words[i - BITBOARD_ROW_WORDS];
+        if (i < BITBOARD_WORDS - BITBOARD_ROW_WORDS)
+            moved |= f[i + BITBOARD_ROW_WORDS] & g_Maze.Exits[up].Words[i + BITBOARD_ROW_WORDS];
+        next->Words[i] = moved;
+    }
+
+    // the tunnel, from the first word of a row to the one with its last column and back
+    for (int first = 0; first < BITBOARD_WORDS; first += BITBOARD_ROW_WORDS) {
+        int last = first + (NUM_COLS - 1) / 64;
+        uint64_t lastBit = 1ull << ((NUM_COLS - 1) % 64);
+        if (f[first] & g_Maze.WrapLeft.Words[first] & 1)
+            next->Words[last] |= lastBit;
+        if (f[last] & g_Maze.WrapRight.Words[last] & lastBit)
+            next->Words[first] |= 1;
+    }
+
+    for (int i = 0; i < BITBOARD_WORDS; i++) {
+        next->Words[i] &= ~visited->Words[i];
+        any |= next->Words[i];
+    }
+    return any != 0;
+}
+#endif
+
+void Distance_Clear(DistanceField* field)
+{
+    for (int i = 0; i < MAZE_CELLS; i++)
+        field->Distance[i] = DISTANCE_UNREACHABLE;
+    field->Layers = 0;
+    field->Bounds = g_WholeMaze;
+}
+
+void Distance_FromSet(DistanceField* field, const Bitboard* sources)
+{
+    // static, a large maze's bitboards don't fit on the kernel stack
+    static Bitboard frontier, visited, next;
+    uint16_t layer = 0;
+
+    Distance_Clear(field);
+
+    Bitboard_And(&frontier, sources, &g_Maze.Walkable);
+    visited = frontier;
+
+    if (Bitboard_Empty(&frontier)) {
+        field->Layers = 0;
+        return;
+    }
+
+    for (;;) {
+        BITBOARD_FOREACH(&frontier, i, field->Distance[i] = layer);
+        layer++;
+
+        if (!Expand(&next, &frontier, &visited))
+            break;
+        Bitboard_Or(&visited, &visited, &next);
+        frontier = next;
+    }
+    field->Layers = layer;
+}
+
+void Distance_FromCell(DistanceField* field, int cell)
+{
+    static Bitboard source;
+    Bitboard_Clear(&source);
+    Bitboard_Set(&source, cell);
+    Distance_FromSet(field, &source);
+}
+
+// Takes the cells queued up to tail, the sources, and goes on from them.
+// Without a rectangle the search goes everywhere.
+static void Search(DistanceField* field, int tail, const MazeRect* rect)
+{
+    int head = 0;
+
+    while (head < tail) {
+        int current = g_Queue[head++];
+        uint16_t distance = field->Distance[current];
+        uint8_t exits = Maze_Exits(current);
+
+        if (distance + 1 > field->Layers)
+            field->Layers = distance + 1;
+
+        for (int d = left; d <= down; d++) {
+            int next = Maze_Neighbor(current, d);
+            if ((exits & MAZE_EXIT(d)) && field->Distance[next] == DISTANCE_UNREACHABLE
+                    && (rect == NULL || Maze_InRect(rect, next))) {
+                field->Distance[next] = distance + 1;
+                g_Queue[tail++] = next;
+            }
+        }
+    }
+}
+
+void Distance_FromCellScalar(DistanceField* field, int cell)
+{
+    Distance_Clear(field);
+
+    if (Maze_Tile(cell) == TILE_WALL)
+        return;
+
+    field->Distance[cell] = 0;
+    g_Queue[0] = cell;
+    Search(field, 1, NULL);
+}
+
+void Distance_FromCellsInRect(DistanceField* field, const uint16_t* sources, int count, const MazeRect* rect)
+{
+    int tail = 0;
+
+    for (int y = field->Bounds.Y; y < field->Bounds.Y + field->Bounds.Height; y++)
+        for (int x = field->Bounds.X; x < field->Bounds.X + field->Bounds.Width; x++)
+            field->Distance[MAZE_INDEX(x, y)] = DISTANCE_UNREACHABLE;
+    field->Bounds = *rect;
+    field->Layers = 0;
+
+    for (int i = 0; i < count; i++) {
+        int cell = sources[i];
+        if (Maze_Tile(cell) != TILE_WALL && Maze_InRect(rect, cell) && field->Distance[cell] == DISTANCE_UNREACHABLE) {
+            field->Distance[cell] = 0;
+            g_Queue[tail++] = cell;
+        }
+    }
+    Search(field, tail, rect);
+}
+
+uint8_t Distance_BestExits(const DistanceField* field, int cell)
+{
+    uint8_t exits = Maze_Exits(cell);
+    uint8_t best = 0;
+    uint16_t bestDistance = DISTANCE_UNREACHABLE;
+
+    for (int d = left; d <= down; d++) {
+        if (!(exits & MAZE_EXIT(d)))
+            continue;
+
+        uint16_t distance = field->Distance[Maze_Neighbor(cell, d)];
+        if (distance < bestDistance) {
+            bestDistance = distance;
+            best = MAZE_EXIT(d);
+        }
+        else if (distance == bestDistance && distance != DISTANCE_UNREACHABLE) {
+            best |= MAZE_EXIT(d);
+        }
+    }
+    return best;
+}
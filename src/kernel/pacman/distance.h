@@ -0,0 +1,31 @@
+#pragma once
+#include "maze.h"
+#include "bitboard.h"
+#include <stdint.h>
+
+#define DISTANCE_UNREACHABLE    0xFFFF
+
+// Shortest path lengths (in moves) from a set of source cells to every cell
+typedef struct {
+    uint16_t Distance[MAZE_CELLS];
+    uint16_t Layers;        // the number of BFS layers, i.e. the eccentricity of the sources + 1
+    MazeRect Bounds;        // the cells the last search wrote, all the others are unreachable
+} DistanceField;
+
+// Every cell unreachable, for a field whose first search is bounded
+void Distance_Clear(DistanceField* field);
+
+// Bit-parallel BFS on the maze bitboards, a layer costs a few shifts and ands per word
+void Distance_FromSet(DistanceField* field, const Bitboard* sources);
+void Distance_FromCell(DistanceField* field, int cell);
+
+// The same as Distance_FromCell with a plain queue, the reference for the benchmark
+void Distance_FromCellScalar(DistanceField* field, int cell);
+
+// A queue-based BFS that doesn't leave the rectangle, for mazes too large to
+// search whole every tick. Only the last search's bounds are cleared first,
+// so the cost goes with the rectangle rather than with the maze.
+void Distance_FromCellsInRect(DistanceField* field, const uint16_t* sources, int count, const MazeRect* rect);
+
+// The exits of the cell that lead closer to the sources, 0 if there is no way
+uint8_t Distance_BestExits(const DistanceField* field, int cell);
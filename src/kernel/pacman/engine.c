@@ -1,385 +1,539 @@
 #include "engine.h"
+#include "game.h"
+#include "render.h"
+#include "render_vga.h"
+#include "render_ansi.h"
+#include "input.h"
+#include "input_kbd.h"
+#include "autopilot.h"
+#include "actors.h"
+#include "bench.h"
+#include "replay.h"
+#include "collision.h"
+#include "profile.h"
+#include "level_boot.h"
+#include "netplay.h"
+#include "link_serial.h"
+#include "entity.h"
+#include "arena.h"
+#include "capture.h"
 #include <arch/i686/isr.h>
+#include <arch/i686/irq.h>
+#include <arch/i686/tsc.h>
+#include <arch/i686/uart.h>
+#include <arch/i686/io.h>
 #include <debug.h>
+#include <random.h>
+#include <stdio.h>
+#include <util/math.h>
 #include <stdint.h>
 #include <stdbool.h>
 
-#define NUM_ROWS                24
-#define NUM_COLS                28
-#define VGA_BLACK               0
-#define VGA_BLUE                1
-#define VGA_GREEN               2
-#define VGA_CYAN                3
-#define VGA_RED                 4
-#define VGA_MAGENTA             5
-#define VGA_YELLOW              14
-#define VGA_GREEN_BACKGROUND    VGA_GREEN << 4
-#define VGA_RED_BACKGROUND      VGA_RED << 4
-#define VGA_BLACK_SQUARE        0
-#define VGA_WHITE_SQUARE        255
-
-// BEGIN: copied from i8259.c
-#define PIC1_COMMAND_PORT           0x20
-#define PIC_CMD_END_OF_INTERRUPT    0x20
-// END: copied from i8259.c
-
 #define MODULE  "PACMAN"
 #define IRQ0_PERIOD             11  // trigger timer every 15th tick
+#define WAIT_FOR_RETRACE        true // flip the pages on the vertical retrace, false for benchmark runs
+#define STATS_PERIOD            50  // report the input queue stats every 50th frame
+#define GAME_TICKS              500
+#define REPLAY_LINE_BYTES       32  // bytes of the recording per line on the debug port
+#define SOAK_PERIOD             500 // report the soak run every 500th frame
+#define INJECT_PERIOD           7   // a synthetic key byte every 7th timer tick, prime to IRQ0_PERIOD
+#define SIM_PERIOD              IRQ0_PERIOD // timer ticks per simulation tick
+#define SIM_MAX_CATCHUP         4   // simulation ticks in a row at most when the loop is behind
+#define TIMER_MILLIHZ           18207   // the timer at its power-on rate, 1193182 / 65536 Hz
+
+// The level has four ghosts, more are spread over the maze (make GHOSTS=64 for a stress level)
+#ifndef PACMAN_GHOSTS
+#define PACMAN_GHOSTS           4
+#endif
+
+#if PACMAN_GHOSTS > ACTOR_MAX_GHOSTS
+#error "PACMAN_GHOSTS doesn't fit in the actor table"
+#endif
+
+#if defined(PACMAN_SOAK) && defined(PACMAN_RECORD)
+#error "A soak run never ends, so there is no recording to replay"
+#endif
+
+#if defined(PACMAN_SOAK) && defined(PACMAN_LATENCY)
+#error "The latency run types on the keyboard, the soak run listens to the autopilot"
+#endif
+
+#if defined(PACMAN_NETPLAY) && (defined(PACMAN_SOAK) || defined(PACMAN_RECORD) || defined(PACMAN_BENCH))
+#error "The two-player session is the only game of the run, the peer has no part in the others"
+#endif
+
+#if defined(PACMAN_NETPLAY) && defined(PACMAN_ANSI)
+#error "The two-player session and the ANSI screen would share COM1"
+#endif
+
+#if defined(PACMAN_CAPTURE_COM1) && (defined(PACMAN_NETPLAY) || defined(PACMAN_ANSI))
+#error "The capture would share COM1 with the peer or the ANSI screen"
+#endif
+
+// The VGA text pages, or the ANSI terminal on COM1 (make ANSI=1)
+#ifdef PACMAN_ANSI
+#define RENDER_DRIVER()         RenderAnsi_GetDriver()
+#else
+#define RENDER_DRIVER()         RenderVGA_GetDriver()
+#endif
+
+#ifdef PACMAN_RECORD
+// The state hash after every tick of the game, the replay has to match them
+static uint32_t g_RecordedHashes[GAME_TICKS];
+#endif
 
-struct Actor {
-    int pos_y;
-    int pos_x;
-
-    // We keep the last position to prefer going forward
-    // rather that back
-    int last_pos_y;
-    int last_pos_x;
-    uint8_t color;
-    unsigned char symbol;
-} ghost5, ghost6, ghost7, ghost8, pacman;
-
-int initial_landscape[NUM_ROWS][NUM_COLS] = {
-    { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 },
-    { 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1 },
-    { 1, 2, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 2, 1, 1, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 2, 1 },
-    { 1, 3, 1, 0, 0, 1, 2, 1, 0, 0, 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 1, 2, 1, 0, 0, 1, 3, 1 },
-    //{ 1, 2, 1, 0, 0, 1, 2, 1, 0, 0, 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 1, 2, 1, 0, 0, 1, 2, 1 },
-    { 1, 2, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 2, 1, 1, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 2, 1 },
-    { 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1 },
-    //{ 1, 2, 1, 1, 1, 1, 2, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 2, 1, 1, 1, 1, 2, 1 },
-    { 1, 2, 1, 1, 1, 1, 2, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 2, 1, 1, 1, 1, 2, 1 },
-    { 1, 2, 2, 2, 2, 2, 2, 1, 1, 2, 2, 2, 2, 1, 1, 2, 2, 2, 2, 1, 1, 2, 2, 2, 2, 2, 2, 1 },
-    { 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1 },
-    //{ 0, 0, 0, 0, 0, 1, 2, 1, 1, 1, 1, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 2, 1, 0, 0, 0, 0, 0 },
-    { 0, 0, 0, 0, 0, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 1, 0, 0, 0, 0, 0 },
-    { 0, 0, 0, 0, 0, 1, 2, 1, 1, 0, 1, 1, 1, 4, 4, 1, 1, 1, 0, 1, 1, 2, 1, 0, 0, 0, 0, 0 },
-    { 1, 1, 1, 1, 1, 1, 2, 1, 1, 0, 1, 0, 0, 0, 6, 5, 0, 1, 0, 0, 0, 2, 1, 1, 1, 1, 1, 1 },
-    { 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 8, 7, 0, 0, 0, 1, 0, 1, 1, 2, 0, 0, 0, 0, 0, 0 },
-    { 1, 1, 1, 1, 1, 1, 2, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 2, 1, 1, 1, 1, 1, 1 },
-    { 0, 0, 0, 0, 0, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 1, 0, 0, 0, 0, 0 },
-    { 1, 1, 1, 1, 1, 1, 2, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 2, 1, 1, 1, 1, 1, 1 },
-    { 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1 },
-    //{ 1, 2, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 2, 1, 1, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 2, 1 },
-    { 1, 2, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 2, 1, 1, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 2, 1 },
-    { 1, 3, 2, 2, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 9, 2, 2, 2, 2, 2, 2, 2, 1, 1, 2, 2, 3, 1 },
-    //{ 1, 1, 1, 2, 1, 1, 2, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 2, 1, 1, 2, 1, 1, 1 },
-    { 1, 1, 1, 2, 1, 1, 2, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 2, 1, 1, 2, 1, 1, 1 },
-    { 1, 2, 2, 2, 2, 2, 2, 1, 1, 2, 2, 2, 2, 1, 1, 2, 2, 2, 2, 1, 1, 2, 2, 2, 2, 2, 2, 1 },
-    { 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1 },
-    { 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1 },
-    { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 }
-};
-
-char scancode_to_ascii[] = {
-    0,  27, '1', '2', '3', '4', '5', '6', '7', '8', '9', '0', '-', '=', '\b',
-    '\t', 'q', 'w', 'e', 'r', 't', 'y', 'u', 'i', 'o', 'p', '[', ']', '\n',
-    0, 'a', 's', 'd', 'f', 'g', 'h', 'j', 'k', 'l', ';', '\'', '`',
-    0, '\\', 'z', 'x', 'c', 'v', 'b', 'n', 'm', ',', '.', '/', 0,
-    '*', 0, ' ', 0
-};
-
-typedef enum { left=0, right=1, up=2, down=3 } Direction;
-
-int game_window[NUM_ROWS][NUM_COLS];
-Direction RandomDirection();
-
-static int support_rdrand = false;
-
-void DrawActor(struct Actor ghost)
-{
-    // TODO: check collisions
-    VGA_putchr(ghost.pos_x, ghost.pos_y, ghost.symbol);
-    VGA_putcolor(ghost.pos_x, ghost.pos_y, ghost.color);
-}
+bool its_time = false;
+volatile uint32_t g_TimerTicks;
 
-void DrawWindow()
+void Wait()
 {
-    //vfprintf(VFS_FD_STDOUT, fmt, args);
-    for (int y = 0; y < NUM_ROWS; y++) {
-        for (int x = 0; x < NUM_COLS; x++) {
-            switch ( game_window[y][x] ) {
-            case 0: VGA_putchr(x, y, ' '); VGA_putcolor(x, y, VGA_BLACK_SQUARE); break; // black path
-            case 1: VGA_putchr(x, y, ' '); VGA_putcolor(x, y, VGA_WHITE_SQUARE); break; // white wall
-            case 2: VGA_putchr(x, y, '.'); break;
-            case 3: VGA_putchr(x, y, '*'); break;
-            case 4: VGA_putchr(x, y, ' '); VGA_putcolor(x, y, VGA_GREEN_BACKGROUND); break; // grean exit
-            default: VGA_putchr(x, y, ' '); VGA_putcolor(x, y, VGA_BLACK_SQUARE); break;
-            }
-        }
-    }
-    DrawActor(ghost5);
-    //DrawActor(ghost6);
-    //DrawActor(ghost7);
-    //DrawActor(ghost8);
-    DrawActor(pacman);
+    PROFILE_BEGIN(WAIT);
+    PROFILE_DEADLINE(its_time);    // the timer fired before the frame was done
+    while(false == its_time);
+    its_time = false;
+    PROFILE_END(WAIT);
 }
 
-void MovePacman(Direction direction)
+void LogInputStats()
 {
-    switch(direction) {
-        case left: // right-->left
-            if (game_window[pacman.pos_y][pacman.pos_x-1] != 1) {
-                pacman.last_pos_x = pacman.pos_x;
-                pacman.pos_x--;
-            }
-            break;
-        case right: // left-->right
-            if (game_window[pacman.pos_y][pacman.pos_x+1] != 1) {
-                pacman.last_pos_x = pacman.pos_x;
-                pacman.pos_x++;
-            }
-            break;
-        case up: // down-->up
-            if (game_window[pacman.pos_y-1][pacman.pos_x] != 1) {
-                pacman.last_pos_y = pacman.pos_y;
-                pacman.pos_y--;
-            }
-            break;
-        case down: // up-->down
-            if (game_window[pacman.pos_y+1][pacman.pos_x] != 1) {
-                pacman.last_pos_y = pacman.pos_y;
-                pacman.pos_y++;
-            }
-            break;
-        default:
-            log_err("pacman-kbd", "MOVE PACMAN, DEFAULT direction=%d", direction);
-        break;
-    }
-    DrawWindow();
-}
+    const InputStats* stats = Input_GetStats();
+    uint32_t avg = stats->IrqCount ? div64_32(stats->IrqTotalCycles, stats->IrqCount) : 0;
 
+    log_info(MODULE, "input: %u pushed, %u popped, %u dropped in %u overflows, high water %u/%u",
+        stats->Pushed, stats->Popped, stats->Dropped, stats->Overflows, stats->HighWater, INPUT_QUEUE_SIZE);
+    log_info(MODULE, "input: %u IRQs, %u cycles avg, %u cycles max",
+        stats->IrqCount, avg, stats->IrqMaxCycles);
+}
 
-void MoveGhost(struct Actor* ghost)
+// Binary data as hex lines of the prefix, REPLAY_LINE_BYTES bytes each
+void HexLines(const char* prefix, const uint8_t* data, uint32_t size, void (*put)(const char* line))
 {
-    bool mooved = false;
-    if ((game_window[ghost->pos_y+1][ghost->pos_x] == 1)
-        && (game_window[ghost->pos_y-1][ghost->pos_x] == 1)
-        && (game_window[ghost->pos_y][ghost->pos_x+1] == 1)
-        && (game_window[ghost->pos_y][ghost->pos_x-1] == 1)) {
-            log_debug("PACMAN", "The ghost is trapped. How is that possible?");
-    }
-    
-    // if we can go straight go straight
-    /*if (ghost->last_pos_y != ghost->pos_y) {
-        if (ghost->last_pos_y < ghost->pos_y) { // up-->down
-            if (game_window[ghost->pos_y+1][ghost->pos_x] != 1) {
-                ghost->last_pos_y = ghost->pos_y;
-                ghost->pos_y++;
-                return;
-            }
-        } else { // down-->up
-            if (game_window[ghost->pos_y-1][ghost->pos_x] != 1) {
-                ghost->last_pos_y = ghost->pos_y;
-                ghost->pos_y--;
-                return;
-            }
-        }
-    } else {
-        if (ghost->last_pos_x < ghost->pos_x) { // right-->left
-            if (game_window[ghost->pos_y][ghost->pos_x-1] != 1) {
-                ghost->last_pos_x = ghost->pos_x;
-                ghost->pos_x--;
-                return;
-            }
-        } else { // left-->right
-            if (game_window[ghost->pos_y][ghost->pos_x+1] != 1) {
-                ghost->last_pos_x = ghost->pos_x;
-                ghost->pos_x++;
-                return;
-            }
-        }
-    }*/
-    while (false == mooved) {
-        Direction dir = RandomDirection();
-        switch(dir) {
-        case left: // move left
-            if (game_window[ghost->pos_y][ghost->pos_x-1] != 1) {
-                ghost->last_pos_x = ghost->pos_x;
-                ghost->pos_x--;
-                mooved = true;
-            }
-            break;
-        case right: // move right
-            if (game_window[ghost->pos_y][ghost->pos_x+1] != 1) {
-                ghost->last_pos_x = ghost->pos_x;
-                ghost->pos_x++;
-                mooved = true;
-            }
-            break;
-        case up: // move up
-            if (game_window[ghost->pos_y-1][ghost->pos_x] != 1) {
-                ghost->last_pos_y = ghost->pos_y;
-                ghost->pos_y--;
-                mooved = true;
-            }
-            break;
-        case down: // move down
-            if (game_window[ghost->pos_y+1][ghost->pos_x] != 1) {
-                ghost->last_pos_y = ghost->pos_y;
-                ghost->pos_y++;
-                mooved = true;
-            }
-            break;
+    static const char hex[] = "0123456789abcdef";
+    char line[sizeof("CAPTURE \n") + 2 * REPLAY_LINE_BYTES];
+
+    while (size > 0) {
+        uint32_t count = size < REPLAY_LINE_BYTES ? size : REPLAY_LINE_BYTES;
+        char* p = line;
+        for (const char* c = prefix; *c; c++)
+            *p++ = *c;
+        for (uint32_t i = 0; i < count; i++) {
+            *p++ = hex[data[i] >> 4];
+            *p++ = hex[data[i] & 0xF];
         }
+        *p++ = '\n';
+        *p = '\0';
+        put(line);
+
+        data += count;
+        size -= count;
     }
 }
 
-bool its_time = false;
+// The recording goes to the debug port as hex lines, "REPLAY 504d5250...".
+// build/host/replay_tool takes the captured log (qemu -debugcon file:...) and replays it.
+void ReplayToDebugPort(const uint8_t* data, uint32_t size)
+{
+    HexLines("REPLAY ", data, size, debugs);
+}
 
-void Wait()
+#ifdef PACMAN_CAPTURE
+#ifdef PACMAN_CAPTURE_COM1
+// Waits for the UART, the time it takes counts against the capture's budget
+void SerialLine(const char* line)
 {
-    while(false == its_time);
-    its_time = false;
+    while (*line)
+        if (i686_UART_TryWrite(UART_COM1, *line))
+            line++;
 }
+#define CAPTURE_LINE_OUT        SerialLine
+#else
+#define CAPTURE_LINE_OUT        debugs
+#endif
+
+// The frames go out as "CAPTURE cf01..." lines, on the debug port or COM1
+// (make CAPTURE=com1). build/host/capture_tool plays and reports them.
+void CaptureToLines(const uint8_t* data, uint32_t size)
+{
+    HexLines("CAPTURE ", data, size, CAPTURE_LINE_OUT);
+}
+
+void LogCaptureStats()
+{
+    const CaptureStats* stats = Capture_GetStats();
 
-bool has_rdrand() {
-    uint32_t eax, ecx;
-    __asm__ volatile ("cpuid" : "=a" (eax), "=c" (ecx) : "a" (1));
-    return (ecx >> 30) & 1;  // Check RDRAND support (bit 30 in ECX)
+    log_info(MODULE, "capture: %u frames, %u bytes, %u cells, %u frames partial",
+        stats->Frames, stats->Bytes, stats->Cells, stats->Partial);
+    log_info(MODULE, "capture: %u cycles avg, %u max, %u frames over the budget of %u",
+        stats->Frames ? div64_32(stats->TotalCycles, stats->Frames) : 0, stats->MaxCycles,
+        stats->OverBudget, CAPTURE_BUDGET_CYCLES);
 }
+#endif
 
-// rdrand doesn't need a seed
-uint32_t rdrand() {
-    uint32_t val;
-    uint8_t success;
-    __asm__ volatile ("rdrand %0; setc %1" : "=r" (val), "=qm" (success));
-    return success ? val : 0;  // Return 0 if failed
+#ifdef PACMAN_NETPLAY
+void LogNetplayStats()
+{
+    const NetplayStats* stats = Netplay_GetStats();
+    uint32_t avg = stats->Rollbacks ? div64_32(stats->ReplayCycles, stats->Rollbacks) : 0;
+
+    log_info(MODULE, "netplay: %u ticks, the peer's confirmed up to %u, %u stalls, %u bytes out, %u in, %u bad packets",
+        stats->Ticks, stats->Confirmed, stats->Stalls, stats->BytesSent, stats->BytesReceived, stats->BadPackets);
+    log_info(MODULE, "netplay: %u rollbacks, %u ticks played again, %u at most, %u cycles avg, %u max",
+        stats->Rollbacks, stats->ReplayedTicks, stats->MaxDepth, avg, stats->MaxReplayCycles);
 }
+#endif
 
-// rdseed is the same as rdrand, but better cryptographic level
-uint32_t rdseed() {
-    uint32_t val;
-    uint8_t success;
-    __asm__ volatile ("rdseed %0; setc %1" : "=r" (val), "=qm" (success));
-    return success ? val : 0;
+void LogCollisionStats()
+{
+    const CollisionStats* stats = Collision_GetStats();
+    log_info(MODULE, "collisions: %u ticks, %u same cell, %u swaps, %u dropped",
+        stats->Ticks, stats->SameCell, stats->Swaps, stats->Dropped);
 }
 
-static uint32_t seed = 0;  // Initialize seed
+// What the stress levels need of the entity pool and the frame arena
+void LogMemoryStats()
+{
+    const EntityStats* entities = Entity_GetStats();
+    const ArenaStats* arena = Arena_GetStats();
 
-void seed_rng(void) {
-    uint32_t low, high;
-    __asm__ volatile ("rdtsc" : "=a"(low), "=d"(high));  // Read TSC
-    seed = low ^ high;  // Mix high and low bits
+    log_info(MODULE, "entities: %u live, high water %u/%u, %u spawned, %u with the pool full, %u stale handles",
+        entities->Live, entities->HighWater, ENTITY_MAX, entities->Spawned, entities->Full, entities->Stale);
+    log_info(MODULE, "arena: %u frames, high water %u/%u bytes, %u allocations failed",
+        arena->Frames, arena->HighWater, ARENA_SIZE, arena->Failed);
 }
 
-uint32_t xorshift(void) {
-    seed_rng();
-    seed ^= seed << 13;
-    seed ^= seed >> 17;
-    seed ^= seed << 5;
-    return seed;
+#ifdef PACMAN_ANSI
+// The bytes a tick's frames cost against what the line carries in a tick
+void LogAnsiStats()
+{
+    const RenderAnsiStats* stats = RenderAnsi_GetStats();
+    uint32_t perTick = Game_GetTick() ? stats->Bytes / Game_GetTick() : 0;
+    uint32_t lineTick = RENDER_ANSI_BYTES_PER_SECOND * SIM_PERIOD * 1000 / TIMER_MILLIHZ;
+
+    log_info(MODULE, "ansi: %u frames, %u bytes avg, %u max, %u dropped for the line, queue high water %u",
+        stats->Frames, stats->Frames ? stats->Bytes / stats->Frames : 0, stats->MaxFrameBytes,
+        stats->Dropped, stats->QueueHighWater);
+    log_info(MODULE, "ansi: %u bytes a tick, the line takes %u, %u bytes sent", perTick, lineTick, stats->Sent);
 }
+#endif
 
-// Rocket-scince true-random generator between [0 and 3]
-Direction RandomDirection()
+#ifdef PACMAN_ANSI
+// The terminal has no retrace to pace the frames, so a frame waits for
+// the next timer tick instead of spinning on ones where nothing moved
+static void WaitForTimer(uint32_t last)
+{
+    i686_DisableInterrupts();
+    while (g_TimerTicks == last) {
+        i686_Halt();
+        i686_DisableInterrupts();
+    }
+    i686_EnableInterrupts();
+}
+#endif
+
+// The simulation ticks every SIM_PERIOD timer ticks whatever the frame rate,
+// the frames are drawn as often as the display allows in between. Time the
+// simulation is behind is worked off with up to SIM_MAX_CATCHUP ticks per frame,
+// more is dropped, so a slow machine plays slower instead of stalling.
+// The frames draw the actors on their way from the last tick's cells to the
+// current ones, by the part of the period that has passed.
+void MainLoop()
 {
-    uint32_t rnd = 0;
-    if (support_rdrand) {
-        rnd = rdrand();
+    uint32_t last = g_TimerTicks, pending = 0;
+    uint32_t catchUps = 0, dropped = 0;
+
+    while (Game_GetTick() < GAME_TICKS) {
+#ifdef PACMAN_ANSI
+        WaitForTimer(last);
+#endif
+        Arena_Reset();
+        uint32_t now = g_TimerTicks;
+        pending += now - last;
+        last = now;
+
+        int steps = 0;
+        while (pending >= SIM_PERIOD && steps < SIM_MAX_CATCHUP && Game_GetTick() < GAME_TICKS) {
+            Game_Update();
+            pending -= SIM_PERIOD;
+            steps++;
+#ifdef PACMAN_RECORD
+            g_RecordedHashes[Game_GetTick() - 1] = Game_StateHash();
+            log_debug(MODULE, "tick %u hash %x", Game_GetTick(), g_RecordedHashes[Game_GetTick() - 1]);
+#endif
+        }
+        PROFILE_DEADLINE(steps > 1);    // the last frame took longer than a tick
+        if (steps > 1)
+            catchUps += steps - 1;
+        if (pending >= SIM_PERIOD) {
+            dropped += pending / SIM_PERIOD;
+            pending %= SIM_PERIOD;
+        }
+
+        Game_Render(pending * GAME_ALPHA_ONE / SIM_PERIOD);
+
+        const RenderStats* stats = Render_GetStats();
+        if (stats->Frames % STATS_PERIOD == 0) {
+            log_info(MODULE, "loop: %u ticks in %u frames, %u catch-up ticks, %u ticks dropped, %u cells a frame at most",
+                Game_GetTick(), stats->Frames, catchUps, dropped, stats->MaxFrameCells);
+            LogInputStats();
+            LogCollisionStats();
+            LogMemoryStats();
+#ifdef PACMAN_CAPTURE
+            LogCaptureStats();
+#endif
+#ifdef PACMAN_ANSI
+            LogAnsiStats();
+#endif
+            PROFILE_DUMP();
+        }
     }
-    else {
-        rnd = xorshift();
+}
+
+#ifdef PACMAN_NETPLAY
+// MainLoop for a two-player session: the ticks go through the netplay layer
+// with the last arrow pressed since the tick before. A tick the peer holds
+// up is tried again on the next pass and the frames go on meanwhile, the
+// time lost waiting isn't made up for beyond SIM_MAX_CATCHUP ticks.
+void NetplayLoop()
+{
+    uint32_t last = g_TimerTicks, pending = 0;
+    uint8_t move = GAME_MOVE_NONE;
+    InputEvent event;
+
+    for (;;) {
+        Arena_Reset();
+        uint32_t now = g_TimerTicks;
+        pending += now - last;
+        last = now;
+
+        while (Input_Pop(&event))
+            if (event.Key != INPUT_KEY_OTHER && !event.Released)
+                move = event.Key;
+
+        Netplay_Poll();
+        if (pending >= SIM_PERIOD && Netplay_Update(move)) {
+            pending -= SIM_PERIOD;
+            move = GAME_MOVE_NONE;
+        }
+        if (pending > SIM_MAX_CATCHUP * SIM_PERIOD)
+            pending = SIM_MAX_CATCHUP * SIM_PERIOD;
+
+        Game_Render(pending * GAME_ALPHA_ONE / SIM_PERIOD);
+
+        const RenderStats* stats = Render_GetStats();
+        if (stats->Frames % STATS_PERIOD == 0) {
+            LogNetplayStats();
+            LogCollisionStats();
+            LogMemoryStats();
+#ifdef PACMAN_CAPTURE
+            LogCaptureStats();
+#endif
+#ifdef PACMAN_ANSI
+            LogAnsiStats();
+#endif
+            PROFILE_DUMP();
+        }
     }
-    return (int)rnd % 4;
 }
+#endif
 
-void MainLoop()
+#ifdef PACMAN_SOAK
+// The autopilot plays game after game until the machine is turned off.
+// Every SOAK_PERIOD frames the debug port gets the totals and the tick times,
+// the worst tick of the period and the worst of the whole run.
+void SoakLoop()
 {
-    for (int i = 0; i < 500; i++) {
-        log_debug("PACMAN", "Ok, we are in the main loop");
-        DrawWindow();
-        MoveGhost(&ghost5);
+    uint32_t periodMax = 0, runMax = 0;
+    uint64_t periodCycles = 0;
+
+    for (;;) {
+        uint64_t start = i686_rdtsc();
+        Game_Step();
+        uint32_t cycles = (uint32_t)(i686_rdtsc() - start);
+
+        periodCycles += cycles;
+        if (cycles > periodMax)
+            periodMax = cycles;
+        if (cycles > runMax)
+            runMax = cycles;
+
+        const RenderStats* stats = Render_GetStats();
+        if (stats->Frames % SOAK_PERIOD == 0) {
+            log_info(MODULE, "soak: %u frames, %u games, level %u, score %u",
+                stats->Frames, Game_GetGames(), Game_GetLevel(), Game_GetScore());
+            log_info(MODULE, "soak: tick %u cycles avg, %u max, %u max since boot",
+                div64_32(periodCycles, SOAK_PERIOD), periodMax, runMax);
+            LogInputStats();
+            LogCollisionStats();
+            LogMemoryStats();
+#ifdef PACMAN_CAPTURE
+            LogCaptureStats();
+#endif
+#ifdef PACMAN_ANSI
+            LogAnsiStats();
+#endif
+            PROFILE_DUMP();
+            periodCycles = 0;
+            periodMax = 0;
+        }
+
+#ifndef PACMAN_SOAK_FAST
         Wait();
+#endif
     }
 }
+#endif
+
+#ifdef PACMAN_LATENCY
+// Types left and right on the keyboard, one byte at a time through the
+// controller, so the keys take the same IRQ1 path as a real keyboard's.
+// The period being prime to the frame's, the presses land all over the frame.
+static void InjectKey()
+{
+    static const uint8_t keys[] = { 0xE0, 0x4B, 0xE0, 0xCB, 0xE0, 0x4D, 0xE0, 0xCD };
+    static int tick = 0, next = 0;
+
+    if (++tick < INJECT_PERIOD)
+        return;
+    tick = 0;
+    if (InputKbd_Inject(keys[next]))
+        next = (next + 1) % sizeof(keys);
+}
+#endif
 
 void irq0_handler_timer(Registers* regs)
 {
     static int tick = 0;
+    PROFILE_BEGIN(IRQ_TIMER);
+    g_TimerTicks++;
     tick++;
     if (tick == IRQ0_PERIOD) {
         //log_warn(MODULE, "Unhandled HUI IRQ %d...", 0);
         tick = 0;
         its_time = true;
     }
+#ifdef PACMAN_LATENCY
+    InjectKey();
+#endif
+    PROFILE_END(IRQ_TIMER);
 }
 
-void irq1_handler_keyboard(Registers* regs)
+void Initialize()
 {
-    static uint8_t last_code = 0;
-    uint8_t scancode = i686_inb(0x60);
-
-    if (scancode == 0xE0) {
-        last_code = 0xE0;  // Mark that an extended key is coming
-        return;
-    }
-
-    if (last_code == 0xE0) {
-        // Handle extended keys (e.g., arrow keys)
-        switch (scancode) {
-            case 0x4B:
-                log_debug("pacman-kbd", "Left Arrow Key Pressed");
-                MovePacman(left);
-                break;
-            case 0x4D:
-                log_debug("pacman-kbd", "Right Arrow Key Pressed");
-                MovePacman(right);
-                break;
-            case 0x48:
-                log_debug("pacman-kbd", "Up Arrow Key Pressed");
-                MovePacman(up);
-                break;
-            case 0x50:
-                log_debug("pacman-kbd", "Down Arrow Key Pressed");
-                MovePacman(down);
-                break;
-            // Handle break codes if needed
-            case 0xCB: log_debug("pacman-kbd", "Left Arrow Key Released"); break;
-            case 0xCD: log_debug("pacman-kbd", "Right Arrow Key Released"); break;
-            case 0xC8: log_debug("pacman-kbd", "Up Arrow Key Released"); break;
-            case 0xD0: log_debug("pacman-kbd", "Down Arrow Key Released"); break;
-            default: log_debug("pacman-kbd", "Unknown Extended Key: 0x%X", scancode); break;
-        }
-        last_code = 0;  // Reset extended key flag
-    } else {
-        log_debug("pacman-kbd", "Regular key pressed: Scan Code = 0x%X, as char('%c')"
-            , scancode, scancode_to_ascii[scancode]);
-    }
-
+    // 1. Setup the timer, the keyboard is set up by its input driver
+    i686_IRQ_RegisterHandler(0, irq0_handler_timer);
 
-    i686_outb(PIC1_COMMAND_PORT, PIC_CMD_END_OF_INTERRUPT);
-    i686_iowait(); // optional
+#ifdef PACMAN_NETPLAY
+    // the peer on COM1 draws the seed and the sides with us
+    bool pacman;
+    uint32_t seed = Netplay_Connect(LinkSerial_GetDriver(), Random_Entropy(), &pacman);
+#endif
+
+    // 2. The game on the VGA text pages and the PS/2 keyboard, or the autopilot for soak runs
+    GameConfig config = {
+        .Render = RENDER_DRIVER(),
+#ifdef PACMAN_SOAK
+        .Input = Autopilot_GetDriver(),
+#else
+        .Input = InputKbd_GetDriver(),
+#endif
+#ifdef PACMAN_SOAK_FAST
+        .WaitRetrace = false,
+#else
+        .WaitRetrace = WAIT_FOR_RETRACE,
+#endif
+#ifdef PACMAN_NETPLAY
+        .Seed = seed,
+        .TwoPlayer = true,
+#else
+        .Seed = Random_Entropy(),   // only the seed is random, the game replays from it
+#endif
+        .Ghosts = PACMAN_GHOSTS,
+#ifdef PACMAN_RECORD
+        .Record = true,
+        .RecordSink = ReplayToDebugPort,
+#endif
+        .Generate = GAME_GENERATE,
+    };
+    config.Levels = LevelBoot_GetLevels(&config.LevelCount);
+#ifdef PACMAN_CAPTURE
+#ifdef PACMAN_CAPTURE_COM1
+    i686_UART_Initialize(UART_COM1, 1);
+#endif
+    Capture_Start(CaptureToLines);
+#endif
+    log_info(MODULE, "seed 0x%x, %s, %s, %u level files", config.Seed, config.Render->Name,
+        config.Input->Name, config.LevelCount);
+    Game_Initialize(&config);
+#ifdef PACMAN_NETPLAY
+    Netplay_Start(pacman);
+#endif
 }
 
-void Initialize()
+#ifdef PACMAN_RECORD
+// Plays the recording of the game again, as fast as it goes unless
+// PACMAN_REPLAY_REALTIME, and checks that every tick ends in the same state
+void ReplayCheck()
 {
-    // 1. Setup the timer
-    i686_IRQ_RegisterHandler(0, irq0_handler_timer);
-    i686_IRQ_RegisterHandler(1, irq1_handler_keyboard);
+    uint32_t size, mismatches = 0;
+    const uint8_t* data = Replay_GetRecording(&size);
+    ReplayHeader header;
 
-    // 2. Check if the CPU has PRNG
-    support_rdrand = has_rdrand();
-    if (!support_rdrand) {
-        log_err("pacman-rnd", "The CPU doesn't provide rdrand/rdseed");
+    if (!Replay_Open(data, size, &header)) {
+        log_err(MODULE, "replay: the recording is broken");
+        return;
     }
-    
-    // 2. Initialize ghosts
-    for (int y = 0; y < NUM_ROWS; y++) {
-        for (int x = 0; x < NUM_COLS; x++) {
-            switch ( initial_landscape[y][x] ) {
-            case 5: ghost5.pos_y = y; ghost5.last_pos_y = y; ghost5.pos_x = x; ghost5.last_pos_x = x; ghost5.color = VGA_RED; ghost5.symbol = 'G'; break;
-            case 6: ghost6.pos_y = y; ghost6.last_pos_y = y; ghost6.pos_x = x; ghost6.last_pos_x = x; ghost6.color = VGA_CYAN; ghost6.symbol = 'G'; break;
-            case 7: ghost7.pos_y = y; ghost7.last_pos_y = y; ghost7.pos_x = x; ghost7.last_pos_x = x; ghost7.color = VGA_MAGENTA; ghost7.symbol = 'G'; break;
-            case 8: ghost8.pos_y = y; ghost8.last_pos_y = y; ghost8.pos_x = x; ghost8.last_pos_x = x; ghost8.color = VGA_YELLOW; ghost8.symbol = 'G'; break;
-            case 9: pacman.pos_y = y; pacman.last_pos_y = y; pacman.pos_x = x; pacman.last_pos_x = x; pacman.color = VGA_YELLOW; pacman.symbol = 'C'; break;
-            default: game_window[y][x] = initial_landscape[y][x];
-            }
+
+    GameConfig config = {
+        .Render = RENDER_DRIVER(),
+        .Input = Replay_GetDriver(),
+        .WaitRetrace = false,
+        .Seed = header.Seed,
+        .Ghosts = header.Ghosts,
+        .Generate = GAME_GENERATE,
+    };
+    config.Levels = LevelBoot_GetLevels(&config.LevelCount);
+    Game_Initialize(&config);
+
+    uint64_t start = i686_rdtsc();
+    while (!Replay_Finished(Game_GetTick()) && Game_GetTick() < GAME_TICKS) {
+        uint32_t tick = Game_GetTick();
+        Game_Step();
+        if (Game_StateHash() != g_RecordedHashes[tick]) {
+            if (mismatches == 0)
+                log_err(MODULE, "replay: tick %u hash %x, recorded %x", tick + 1, Game_StateHash(), g_RecordedHashes[tick]);
+            mismatches++;
         }
+#ifdef PACMAN_REPLAY_REALTIME
+        Wait();
+#endif
     }
+    uint64_t cycles = i686_rdtsc() - start;
+
+    log_info(MODULE, "replay: %u ticks from %u bytes, %u mismatches, %u cycles/tick",
+        Game_GetTick(), size, mismatches, Game_GetTick() ? div64_32(cycles, Game_GetTick()) : 0);
 }
+#endif
 
 void StartGame()
 {
+    LevelBoot_Initialize();
+
+#ifdef PACMAN_BENCH
+    // the benchmarks need the level loaded and they draw random numbers,
+    // so the game starts over after them
     Initialize();
+    Bench_Run();
+#endif
+    Initialize();
+#if defined(PACMAN_SOAK)
+    SoakLoop();
+#elif defined(PACMAN_NETPLAY)
+    NetplayLoop();
+#else
     MainLoop();
-}
\ No newline at end of file
+#endif
+#ifdef PACMAN_RECORD
+    Game_StopRecording();
+    ReplayCheck();
+#endif
+}
@@ -1,4 +1,4 @@
 #pragma once
 #include <stdio.h>
 
-void StartPacman();
\ No newline at end of file
+void StartGame();
\ No newline at end of file
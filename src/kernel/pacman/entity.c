@@ -0,0 +1,90 @@
+#include "entity.h"
+#include <stddef.h>
+
+#define HANDLE(slot, generation)    (((uint32_t)(generation) << 16) | (slot))
+#define HANDLE_SLOT(handle)         ((handle) & 0xFFFF)
+#define HANDLE_GENERATION(handle)   ((uint16_t)((handle) >> 16))
+#define FREE_END                    0xFFFF
+
+static Entity g_Entities[ENTITY_MAX];
+
+// Odd while the slot holds an entity, even while it's free, so the handle
+// of a live entity never has generation 0 and never is ENTITY_NONE
+static uint16_t g_Generation[ENTITY_MAX];
+
+// The free slots, each one points at the next
+static uint16_t g_NextFree[ENTITY_MAX];
+static uint16_t g_FreeHead;
+
+static EntityStats g_Stats;
+
+void Entity_Clear()
+{
+    for (int i = 0; i < ENTITY_MAX; i++) {
+        if (g_Generation[i] & 1)
+            g_Generation[i]++;
+        g_NextFree[i] = i + 1 < ENTITY_MAX ? i + 1 : FREE_END;
+    }
+    g_FreeHead = ENTITY_MAX > 0 ? 0 : FREE_END;
+    g_Stats.Live = 0;
+}
+
+EntityHandle Entity_Spawn(EntityKind kind)
+{
+    if (g_FreeHead == FREE_END) {
+        g_Stats.Full++;
+        return ENTITY_NONE;
+    }
+
+    uint16_t slot = g_FreeHead;
+    g_FreeHead = g_NextFree[slot];
+    g_Generation[slot]++;
+
+    Entity* entity = &g_Entities[slot];
+    entity->Kind = kind;
+    entity->Color = 0;
+    entity->Cell = 0;
+    entity->Frames = 0;
+    entity->Value = 0;
+
+    g_Stats.Spawned++;
+    if (++g_Stats.Live > g_Stats.HighWater)
+        g_Stats.HighWater = g_Stats.Live;
+    return HANDLE(slot, g_Generation[slot]);
+}
+
+void Entity_Free(EntityHandle handle)
+{
+    if (Entity_Get(handle) == NULL)
+        return;
+
+    uint16_t slot = HANDLE_SLOT(handle);
+    g_Generation[slot]++;
+    g_NextFree[slot] = g_FreeHead;
+    g_FreeHead = slot;
+    g_Stats.Live--;
+}
+
+Entity* Entity_Get(EntityHandle handle)
+{
+    uint32_t slot = HANDLE_SLOT(handle);
+    uint16_t generation = HANDLE_GENERATION(handle);
+
+    if (slot >= ENTITY_MAX || !(generation & 1))
+        return NULL;
+    if (g_Generation[slot] != generation) {
+        g_Stats.Stale++;
+        return NULL;
+    }
+    return &g_Entities[slot];
+}
+
+EntityHandle Entity_Handle(int slot)
+{
+    return g_Generation[slot] & 1 ? HANDLE(slot, g_Generation[slot]) : ENTITY_NONE;
+}
+
+const EntityStats* Entity_GetStats()
+{
+    return &g_Stats;
+}
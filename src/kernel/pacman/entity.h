@@ -0,0 +1,58 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+// The engine's short-lived things that come and go during a game (score
+// popups so far), in a pool of fixed size in .bss. A free list makes
+// spawning and freeing O(1), the slots being all the same size nothing
+// fragments. Make ENTITIES=n sizes the pool for stress levels.
+#ifndef ENTITY_MAX
+#define ENTITY_MAX              32
+#endif
+
+#if ENTITY_MAX > 0xFFFF
+#error "The slot of an entity handle has 16 bits"
+#endif
+
+typedef enum {
+    ENTITY_POPUP,           // the points a move scored, where it scored them
+} EntityKind;
+
+typedef struct {
+    uint8_t Kind;
+    uint8_t Color;
+    uint16_t Cell;          // the maze cell it's on
+    uint16_t Frames;        // left to live, for the kinds that expire
+    uint32_t Value;         // the points of a popup
+} Entity;
+
+// The slot in the low half, the slot's generation in the high half. The
+// generation goes up every time the slot is freed, so a handle kept past
+// its entity's end finds nothing instead of the slot's next entity.
+typedef uint32_t EntityHandle;
+
+#define ENTITY_NONE             0   // never a live entity's handle
+
+typedef struct {
+    uint32_t Live;
+    uint32_t HighWater;     // the most live at once
+    uint32_t Spawned;
+    uint32_t Full;          // spawns that found no free slot
+    uint32_t Stale;         // lookups with the handle of a freed entity
+} EntityStats;
+
+// Sets the pool up, or frees every entity: the handles out there all go stale
+void Entity_Clear();
+
+// A zeroed entity of the kind, ENTITY_NONE when the pool is full
+EntityHandle Entity_Spawn(EntityKind kind);
+void Entity_Free(EntityHandle handle);
+
+// The entity, NULL once it was freed
+Entity* Entity_Get(EntityHandle handle);
+
+// The handle of the entity in the slot, ENTITY_NONE for a free slot.
+// The live entities are the slots 0 to ENTITY_MAX - 1 that have one.
+EntityHandle Entity_Handle(int slot);
+
+const EntityStats* Entity_GetStats();
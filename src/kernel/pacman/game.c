@@ -0,0 +1,645 @@
+#include "game.h"
+#include "maze.h"
+#include "level.h"
+#include "maze_gen.h"
+#include "actors.h"
+#include "ghosts.h"
+#include "pellets.h"
+#include "collision.h"
+#include "entity.h"
+#include "arena.h"
+#include "profile.h"
+#include <arch/i686/tsc.h>
+#include <debug.h>
+#include <random.h>
+#include <stddef.h>
+
+#define VGA_BLACK               0
+#define VGA_BLUE                1
+#define VGA_GREEN               2
+#define VGA_CYAN                3
+#define VGA_RED                 4
+#define VGA_MAGENTA             5
+#define VGA_LIGHT_GRAY          7
+#define VGA_YELLOW              14
+#define VGA_GREEN_BACKGROUND    VGA_GREEN << 4
+#define VGA_RED_BACKGROUND      VGA_RED << 4
+#define VGA_BLACK_SQUARE        0
+#define VGA_WHITE_SQUARE        255
+
+// The colors of the ghosts 5..8 of the level, in turn for the extra ones
+static const uint8_t g_GhostColors[] = { VGA_RED, VGA_CYAN, VGA_MAGENTA, VGA_YELLOW };
+
+static const char g_ScancodeToAscii[] = {
+    0,  27, '1', '2', '3', '4', '5', '6', '7', '8', '9', '0', '-', '=', '\b',
+    '\t', 'q', 'w', 'e', 'r', 't', 'y', 'u', 'i', 'o', 'p', '[', ']', '\n',
+    0, 'a', 's', 'd', 'f', 'g', 'h', 'j', 'k', 'l', ';', '\'', '`',
+    0, '\\', 'z', 'x', 'c', 'v', 'b', 'n', 'm', ',', '.', '/', 0,
+    '*', 0, ' ', 0
+};
+
+// The part of the maze on the screen, all of it unless it's larger. The
+// camera keeps pacman at least the margin away from the edges of the view.
+#define VIEW_COLS               (NUM_COLS < RENDER_COLS ? NUM_COLS : RENDER_COLS)
+#define VIEW_ROWS               (NUM_ROWS < RENDER_ROWS ? NUM_ROWS : RENDER_ROWS)
+#define CAMERA_MARGIN_COLS      24
+#define CAMERA_MARGIN_ROWS      8
+
+// The points of an eaten ghost show where it was eaten for about a second
+#define POPUP_FRAMES            60
+#define POPUP_COLOR             VGA_CYAN
+
+#define MODULE                  "PACMAN"
+
+static const InputDriver* g_Input;
+static uint32_t g_Tick;
+static int g_Ghosts;
+static const LevelFileHeader* const* g_Levels;
+static int g_LevelCount;
+static bool g_Generate;
+static bool g_TwoPlayer;
+static uint8_t g_Generated[NUM_ROWS][NUM_COLS];     // the landscape of the generated maze
+static uint32_t g_MazeSerial;   // counts the mazes loaded
+static uint32_t g_MazeSeed;     // the generated maze's
+static bool g_MazeGenerated;
+
+static uint32_t g_Score;
+static uint32_t g_Level;
+static uint8_t g_Lives;
+static uint32_t g_Games;        // the games that ended since Game_Initialize
+static uint16_t g_PowerTicks;   // ticks left of the power pellet, 0 when it's over
+static uint16_t g_GraceTicks;   // ticks left before the ghosts can catch pacman after a respawn
+static uint8_t g_GhostHeading;  // where the second player's ghost goes
+static int g_CameraX;           // the maze cell in the top left corner of the screen
+static int g_CameraY;
+
+static uint16_t TileCell(int tile)
+{
+    switch (tile) {
+    case 0: return RENDER_CELL(' ', VGA_BLACK_SQUARE);      // black path
+    case 1: return RENDER_CELL(' ', VGA_WHITE_SQUARE);      // white wall
+    case 2: return RENDER_CELL('.', VGA_LIGHT_GRAY);
+    case 3: return RENDER_CELL('*', VGA_LIGHT_GRAY);
+    case 4: return RENDER_CELL(' ', VGA_GREEN_BACKGROUND);  // grean exit
+    default: return RENDER_CELL(' ', VGA_BLACK_SQUARE);
+    }
+}
+
+// A cell of the view, x and y from its top left corner
+static void DrawViewCell(int x, int y)
+{
+    Render_SetTile(x, y, TileCell(Maze_Tile(MAZE_INDEX(g_CameraX + x, g_CameraY + y))));
+}
+
+// Cells out of the view are drawn when they scroll in
+static void DrawTile(int index)
+{
+    int x = MAZE_X(index) - g_CameraX, y = MAZE_Y(index) - g_CameraY;
+    if (x >= 0 && x < VIEW_COLS && y >= 0 && y < VIEW_ROWS)
+        DrawViewCell(x, y);
+}
+
+static void DrawView()
+{
+    for (int y = 0; y < VIEW_ROWS; y++)
+        for (int x = 0; x < VIEW_COLS; x++)
+            DrawViewCell(x, y);
+}
+
+// The camera position on one axis that keeps the target margin away from
+// the edges of the view, or as close to that as the maze allows
+static int Follow(int camera, int target, int view, int margin, int size)
+{
+    if (target < camera + margin)
+        camera = target - margin;
+    else if (target >= camera + view - margin)
+        camera = target - view + margin + 1;
+
+    if (camera > size - view)
+        camera = size - view;
+    return camera < 0 ? 0 : camera;
+}
+
+// The tiles on the screen move along with the camera, only the rows and
+// the columns coming into view are drawn from the maze. A jump further
+// than the view (the tunnel, a respawn) draws the view over.
+static void MoveCamera(int x, int y)
+{
+    int dx = x - g_CameraX, dy = y - g_CameraY;
+    if (dx == 0 && dy == 0)
+        return;
+
+    g_CameraX = x;
+    g_CameraY = y;
+    if (dx <= -VIEW_COLS || dx >= VIEW_COLS || dy <= -VIEW_ROWS || dy >= VIEW_ROWS) {
+        DrawView();
+        return;
+    }
+
+    Render_Scroll(dx, dy, VIEW_COLS, VIEW_ROWS);
+    int left = dx > 0 ? VIEW_COLS - dx : 0, right = dx > 0 ? VIEW_COLS : -dx;
+    for (int row = 0; row < VIEW_ROWS; row++)
+        for (int col = left; col < right; col++)
+            DrawViewCell(col, row);
+    int top = dy > 0 ? VIEW_ROWS - dy : 0, bottom = dy > 0 ? VIEW_ROWS : -dy;
+    for (int row = top; row < bottom; row++)
+        for (int col = 0; col < VIEW_COLS; col++)
+            DrawViewCell(col, row);
+}
+
+static void SpawnPopup(uint16_t cell, uint32_t points)
+{
+    Entity* popup = Entity_Get(Entity_Spawn(ENTITY_POPUP));
+    if (popup == NULL)
+        return;     // the pool is full, the points count all the same
+    popup->Cell = cell;
+    popup->Color = POPUP_COLOR;
+    popup->Frames = POPUP_FRAMES;
+    popup->Value = points;
+}
+
+// The popups go over the tiles and under the actors, their digits from
+// the cell on to the right. Every frame drawn takes one off their life.
+static void DrawPopups()
+{
+    for (int slot = 0; slot < ENTITY_MAX; slot++) {
+        EntityHandle handle = Entity_Handle(slot);
+        Entity* popup = Entity_Get(handle);
+        if (popup == NULL || popup->Kind != ENTITY_POPUP)
+            continue;
+
+        char digits[10];
+        int count = 0;
+        uint32_t value = popup->Value;
+        do {
+            digits[count++] = '0' + value % 10;
+            value /= 10;
+        } while (value > 0);
+
+        int x = MAZE_X(popup->Cell) - g_CameraX, y = MAZE_Y(popup->Cell) - g_CameraY;
+        for (int i = 0; y >= 0 && y < VIEW_ROWS && i < count; i++)
+            if (x + i >= 0 && x + i < VIEW_COLS)
+                Render_DrawSprite(x + i, y, RENDER_CELL(digits[count - 1 - i], popup->Color));
+
+        if (--popup->Frames == 0)
+            Entity_Free(handle);
+    }
+}
+
+// Only the cells that differ from what is on the screen are written,
+// i.e. the cells the actors left or entered, the changed tiles and
+// what scrolled
+static void DrawWindow(uint32_t alpha)
+{
+    int32_t x, y;
+
+    Actors_Position(ACTOR_PACMAN, alpha, &x, &y);
+    x = (x + ACTOR_SUBCELL_ONE / 2) >> ACTOR_SUBCELL_BITS;
+    y = (y + ACTOR_SUBCELL_ONE / 2) >> ACTOR_SUBCELL_BITS;
+    MoveCamera(Follow(g_CameraX, x, VIEW_COLS, CAMERA_MARGIN_COLS, NUM_COLS),
+        Follow(g_CameraY, y, VIEW_ROWS, CAMERA_MARGIN_ROWS, NUM_ROWS));
+
+    DrawPopups();
+    Actors_Draw(alpha, g_CameraX, g_CameraY);
+    Render_Present();
+}
+
+static void MovePacman(Direction direction)
+{
+    Actor_Move(ACTOR_PACMAN, direction);
+
+    int cell = g_Actors.Cell[ACTOR_PACMAN];
+    switch (Pellets_Eat(cell)) {
+    case TILE_DOT:
+        g_Score += PELLET_DOT_SCORE;
+        DrawTile(cell);
+        break;
+    case TILE_POWER:
+        g_Score += PELLET_POWER_SCORE;
+        g_PowerTicks = GAME_POWER_TICKS;
+        DrawTile(cell);
+        break;
+    default:
+        break;
+    }
+}
+
+static void ApplyInput(const InputEvent* event)
+{
+    static const char* const names[] = { "Left", "Right", "Up", "Down" };
+
+    if (event->Key == INPUT_KEY_OTHER) {
+        if (event->Extended)
+            log_debug("pacman-kbd", "Unknown Extended Key: 0x%X", event->Scancode);
+        else if (!event->Released && event->Scancode < sizeof(g_ScancodeToAscii))
+            log_debug("pacman-kbd", "Regular key pressed: Scan Code = 0x%X, as char('%c')"
+                , event->Scancode, g_ScancodeToAscii[event->Scancode]);
+        return;
+    }
+
+    if (event->Released) {
+        log_debug("pacman-kbd", "%s Arrow Key Released", names[event->Key]);
+        return;
+    }
+
+    log_debug("pacman-kbd", "%s Arrow Key Pressed", names[event->Key]);
+    PROFILE_MOVE(event->Timestamp);
+    MovePacman((Direction)event->Key);
+}
+
+// Pacman goes on his spawn point, the ghosts on theirs as long as they're wanted
+static void SpawnActor(uint8_t kind, uint16_t cell, int ghosts, int* spawned)
+{
+    if (kind == LEVEL_SPAWN_PACMAN) {
+        g_Actors.Cell[ACTOR_PACMAN] = cell;
+        g_Actors.LastCell[ACTOR_PACMAN] = cell;
+        g_Actors.Spawn[ACTOR_PACMAN] = cell;
+        g_Actors.Prev[ACTOR_PACMAN] = cell;
+    }
+    else if (kind >= LEVEL_SPAWN_GHOST && kind < LEVEL_SPAWN_GHOST + LEVEL_SPAWN_GHOST_KINDS && *spawned < ghosts) {
+        Actors_Add(cell, g_GhostColors[kind - LEVEL_SPAWN_GHOST], 'G');
+        (*spawned)++;
+    }
+}
+
+// The spawn points come from the level file, or else from the landscape of
+// rows x cols the maze was loaded from
+static void SpawnActors(const LevelFileHeader* level, const uint8_t* landscape, int rows, int cols, int ghosts)
+{
+    int spawned = 0;
+
+    if (ghosts > ACTOR_MAX_GHOSTS)
+        ghosts = ACTOR_MAX_GHOSTS;
+
+    Actors_Clear();
+    Actors_Add(0, VGA_YELLOW, 'C');
+    if (level != NULL) {
+        const LevelFileSpawn* spawns = LevelFile_Spawns(level);
+        for (int i = 0; i < level->SpawnCount; i++)
+            SpawnActor(spawns[i].Kind, spawns[i].Cell, ghosts, &spawned);
+    }
+    else {
+        // on a larger maze the first copy of the level has the spawn points
+        for (int y = 0; y < rows; y++)
+            for (int x = 0; x < cols; x++)
+                SpawnActor(landscape[y * cols + x], MAZE_INDEX(x, y), ghosts, &spawned);
+    }
+    if (spawned < ghosts)
+        Actors_Spread(ghosts - spawned, g_Actors.Spawn[ACTOR_PACMAN], GAME_SPAWN_RADIUS,
+            'G', g_GhostColors, sizeof(g_GhostColors));
+}
+
+// A new maze from the game's random stream, so the seed of the game and its
+// input still replay it. Returns false if the generator gave up.
+static bool GenerateMaze()
+{
+    MazeGenStats stats;
+    uint32_t seed = Random_Next();
+    uint64_t start = i686_rdtsc();
+    bool generated = MazeGen_Generate(seed, &g_Generated[0][0], &stats);
+    uint32_t cycles = (uint32_t)(i686_rdtsc() - start);
+
+    if (!generated) {
+        log_warn(MODULE, "maze: nothing usable from seed %x, the compiled level instead", stats.Seed);
+        return false;
+    }
+    log_info(MODULE, "maze: seed %x in %u cycles, %u attempts, %u walkable, %u pellets, %u junctions",
+        stats.Seed, cycles, stats.Attempts, stats.Walkable, stats.Pellets, stats.Junctions);
+    g_MazeSeed = seed;
+    return true;
+}
+
+// The compiled level has the routing tables for the ghosts, its own file
+// too: the level compiler writes the checksum of that file into level_gen.h.
+// Without them the ghosts search, with other exits and other draws of the
+// random stream, and a recording wouldn't replay on the other one.
+static bool RoutedLevel(const LevelFileHeader* level)
+{
+    if (g_MazeGenerated || !LEVEL_ROUTES_MAZE)
+        return false;
+    return level == NULL || (level->Checksum == LEVEL_FILE_CHECKSUM
+        && level->Rows == LEVEL_ROWS && level->Cols == LEVEL_COLS);
+}
+
+// The maze of the current level with all its pellets: the generated one,
+// else the level files in turn, without them it's always the compiled
+// level. Returns the level file it came from, NULL for the others.
+static const LevelFileHeader* LoadMaze()
+{
+    const LevelFileHeader* level = !g_MazeGenerated && g_LevelCount > 0 ? g_Levels[g_Level % g_LevelCount] : NULL;
+
+    if (g_MazeGenerated) {
+        Maze_Load(&g_Generated[0][0], NUM_ROWS, NUM_COLS);
+        Pellets_Load();
+    }
+    else if (level != NULL) {
+        LevelFile_Load(level);
+    }
+    else {
+        Maze_Load(&g_LevelLandscape[0][0], LEVEL_ROWS, LEVEL_COLS);
+        Pellets_Load();
+    }
+    Ghosts_Initialize(RoutedLevel(level));
+    return level;
+}
+
+// A fresh maze, the actors back on their spawn points
+static void LoadLevel()
+{
+    g_MazeGenerated = g_Generate && GenerateMaze();
+    g_MazeSerial++;
+
+    const LevelFileHeader* level = LoadMaze();
+    if (g_MazeGenerated)
+        SpawnActors(NULL, &g_Generated[0][0], NUM_ROWS, NUM_COLS, g_Ghosts);
+    else if (level != NULL)
+        SpawnActors(level, NULL, 0, 0, g_Ghosts);
+    else
+        SpawnActors(NULL, &g_LevelLandscape[0][0], LEVEL_ROWS, LEVEL_COLS, g_Ghosts);
+    g_GhostHeading = up;
+    g_PowerTicks = 0;
+    g_GraceTicks = GAME_RESPAWN_TICKS;
+    Entity_Clear();
+
+    // the view centered on pacman
+    uint16_t pacman = g_Actors.Cell[ACTOR_PACMAN];
+    g_CameraX = Follow(MAZE_X(pacman) - VIEW_COLS / 2, MAZE_X(pacman), VIEW_COLS, 0, NUM_COLS);
+    g_CameraY = Follow(MAZE_Y(pacman) - VIEW_ROWS / 2, MAZE_Y(pacman), VIEW_ROWS, 0, NUM_ROWS);
+    DrawView();
+}
+
+// A powered pacman eats the ghost, otherwise the ghost gets him and the
+// round starts over, unless he only just respawned. Returns false when the
+// rest of the tick's events are moot.
+static bool ApplyCollision(const CollisionEvent* event)
+{
+    if (g_PowerTicks > 0) {
+        g_Score += GAME_GHOST_SCORE;
+        SpawnPopup(g_Actors.Cell[event->Ghost], GAME_GHOST_SCORE);
+        Actor_Respawn(event->Ghost);
+        Ghosts_Restart(event->Ghost);
+        return true;
+    }
+    if (g_GraceTicks > 0)
+        return true;
+
+    g_Lives--;
+    log_info(MODULE, "Pacman caught on tick %u (%s), %u lives left", event->Tick,
+        event->Kind == COLLISION_SWAP ? "swap" : "same cell", g_Lives);
+
+    if (g_Lives == 0) {
+        log_info(MODULE, "Game over, score %u", g_Score);
+        g_Games++;
+        g_Score = 0;
+        g_Level = 0;
+        g_Lives = GAME_LIVES;
+        LoadLevel();
+    }
+    else {
+        for (int i = 0; i < g_Actors.Count; i++) {
+            Actor_Respawn(i);
+            Ghosts_Restart(i);
+        }
+        g_PowerTicks = 0;
+        g_GraceTicks = GAME_RESPAWN_TICKS;
+    }
+    return false;
+}
+
+void Game_Initialize(const GameConfig* config)
+{
+    if (g_Input != NULL && g_Input != config->Input)
+        g_Input->Shutdown();
+    g_Input = config->Input;
+    g_Tick = 0;
+    g_Ghosts = config->Ghosts;
+    g_Levels = config->Levels;
+    g_LevelCount = config->LevelCount;
+    g_Generate = config->Generate;
+    g_TwoPlayer = config->TwoPlayer && config->Ghosts > 0;
+    g_Score = 0;
+    g_Level = 0;
+    g_Lives = GAME_LIVES;
+    g_Games = 0;
+    g_MazeSerial = 0;
+    Random_Seed(config->Seed);
+    Ghosts_SetPlayer(g_TwoPlayer ? ACTOR_FIRST_GHOST : -1);
+
+    // 1. The renderer takes the maze from here
+    Render_Initialize(config->Render, config->WaitRetrace);
+
+    // 2. The maze, the pellets and the actors
+    LoadLevel();
+
+    // 3. Start listening
+    g_Input->Initialize();
+    if (config->Record)
+        Replay_StartRecording(config->Seed, g_Actors.Count - ACTOR_FIRST_GHOST, config->RecordSink);
+}
+
+// The rest of the tick after the input: the ghosts, the collisions and the level
+static void Simulate()
+{
+    if (g_GraceTicks > 0)
+        g_GraceTicks--;
+
+    PROFILE_BEGIN(GHOSTS);
+    if (g_TwoPlayer)
+        Actor_Move(ACTOR_FIRST_GHOST, (Direction)g_GhostHeading);
+    Ghosts_Update();
+    PROFILE_END(GHOSTS);
+
+    PROFILE_BEGIN(COLLISION);
+    Collision_Detect(g_Tick);
+    CollisionEvent collision;
+    while (Collision_Pop(&collision)) {
+        if (!ApplyCollision(&collision)) {
+            Collision_Flush();
+            break;
+        }
+    }
+    PROFILE_END(COLLISION);
+
+    if (g_PowerTicks > 0)
+        g_PowerTicks--;
+    if (Pellets_Cleared()) {
+        g_Level++;
+        log_info(MODULE, "Level %u cleared on tick %u, score %u", g_Level, g_Tick, g_Score);
+        LoadLevel();
+    }
+    g_Tick++;
+}
+
+void Game_Update()
+{
+    InputEvent event;
+
+    PROFILE_BEGIN(STEP);
+    Actors_Snapshot();
+    Collision_BeginTick();
+
+    PROFILE_BEGIN(INPUT);
+    g_Input->Poll(g_Tick);
+    while (Input_Pop(&event)) {
+        Replay_RecordEvent(g_Tick, &event);
+        ApplyInput(&event);
+    }
+    PROFILE_END(INPUT);
+
+    Simulate();
+
+    if (Replay_IsRecording())
+        Replay_Flush();
+    PROFILE_END(STEP);
+}
+
+void Game_UpdateMoves(const GameMoves* moves)
+{
+    PROFILE_BEGIN(STEP);
+    Actors_Snapshot();
+    Collision_BeginTick();
+
+    if (moves->Pacman != GAME_MOVE_NONE)
+        MovePacman((Direction)moves->Pacman);
+    if (moves->Ghost != GAME_MOVE_NONE)
+        g_GhostHeading = moves->Ghost;
+
+    Simulate();
+    PROFILE_END(STEP);
+}
+
+void Game_Render(uint32_t alpha)
+{
+    PROFILE_BEGIN(DRAW);
+    DrawWindow(alpha < GAME_ALPHA_ONE ? alpha : GAME_ALPHA_ONE);
+    PROFILE_END(DRAW);
+
+    // the moves applied so far show once pacman is drawn on his new cell
+    if (alpha >= GAME_ALPHA_ONE / 2)
+        PROFILE_PRESENTED();
+}
+
+void Game_Step()
+{
+    Arena_Reset();
+    Game_Update();
+    Game_Render(GAME_ALPHA_ONE);
+}
+
+uint32_t Game_GetTick()
+{
+    return g_Tick;
+}
+
+uint32_t Game_GetScore()
+{
+    return g_Score;
+}
+
+uint32_t Game_GetLevel()
+{
+    return g_Level;
+}
+
+uint8_t Game_GetLives()
+{
+    return g_Lives;
+}
+
+uint32_t Game_GetGames()
+{
+    return g_Games;
+}
+
+bool Game_IsPowered()
+{
+    return g_PowerTicks > 0;
+}
+
+void Game_StopRecording()
+{
+    Replay_StopRecording(g_Tick);
+}
+
+void Game_SaveState(GameState* state)
+{
+    state->Tick = g_Tick;
+    state->Score = g_Score;
+    state->Level = g_Level;
+    state->Games = g_Games;
+    state->MazeSerial = g_MazeSerial;
+    state->MazeSeed = g_MazeSeed;
+    state->MazeGenerated = g_MazeGenerated;
+    state->Lives = g_Lives;
+    state->GhostHeading = g_GhostHeading;
+    state->PowerTicks = g_PowerTicks;
+    state->GraceTicks = g_GraceTicks;
+    Random_Save(&state->Random);
+    state->Pellets = g_Pellets;
+    Actors_Save(&state->Actors);
+    Ghosts_Save(&state->Ghosts);
+}
+
+void Game_LoadState(const GameState* state)
+{
+    g_Tick = state->Tick;
+    g_Score = state->Score;
+    g_Level = state->Level;
+    g_Games = state->Games;
+    g_Lives = state->Lives;
+    g_GhostHeading = state->GhostHeading;
+    g_PowerTicks = state->PowerTicks;
+    g_GraceTicks = state->GraceTicks;
+    Random_Load(&state->Random);
+
+    // back across a level change, the pellets are restored on the level's maze
+    if (state->MazeSerial != g_MazeSerial) {
+        MazeGenStats stats;
+        g_MazeSerial = state->MazeSerial;
+        g_MazeSeed = state->MazeSeed;
+        g_MazeGenerated = state->MazeGenerated;
+        if (g_MazeGenerated)
+            MazeGen_Generate(g_MazeSeed, &g_Generated[0][0], &stats);
+        LoadMaze();
+    }
+    Pellets_Restore(&state->Pellets);
+    Actors_Load(&state->Actors);
+    Ghosts_Load(&state->Ghosts);
+
+    // the popups aren't part of the state, the ticks played again bring theirs back
+    Entity_Clear();
+    DrawView();
+}
+
+// FNV-1a
+static uint32_t Hash(uint32_t hash, uint32_t value)
+{
+    for (int i = 0; i < 4; i++) {
+        hash = (hash ^ (value & 0xFF)) * 16777619u;
+        value >>= 8;
+    }
+    return hash;
+}
+
+uint32_t Game_StateHash()
+{
+    static GhostState ghosts;
+    uint32_t hash = 2166136261u;
+
+    hash = Hash(hash, g_Tick);
+    hash = Hash(hash, Random_GetState());
+    hash = Hash(hash, g_Score);
+    hash = Hash(hash, g_Lives);
+    hash = Hash(hash, g_PowerTicks | ((uint32_t)g_Pellets.Remaining << 16));
+    hash = Hash(hash, g_GraceTicks);
+    for (int i = 0; i < g_Actors.Count; i++)
+        hash = Hash(hash, g_Actors.Cell[i] | ((uint32_t)g_Actors.LastCell[i] << 16));
+
+    // how far the scripts got, not the lines they're at, which move with every edit of ghosts.c
+    Ghosts_Save(&ghosts);
+    for (int i = ACTOR_FIRST_GHOST; i < g_Actors.Count; i++)
+        hash = Hash(hash, ghosts.Scripts[i].Ticks);
+    if (g_TwoPlayer)
+        hash = Hash(hash, g_GhostHeading);
+    return hash;
+}
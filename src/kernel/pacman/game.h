@@ -0,0 +1,110 @@
+#pragma once
+#include "render.h"
+#include "input.h"
+#include "replay.h"
+#include "actors.h"
+#include "ghosts.h"
+#include "pellets.h"
+#include "level_file.h"
+#include <random.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// The simulation, free of any hardware: the platform hands it the drivers
+// and calls Game_Update() at its own pace, and Game_Render() as often as it can
+typedef struct {
+    const RenderDriver* Render;
+    const InputDriver* Input;
+    bool WaitRetrace;       // flip the pages on the vertical retrace, false for benchmark runs
+    uint32_t Seed;          // the same seed and input give the same game
+    int Ghosts;             // more than the level has are spread over the maze
+    bool Record;            // record the input for a replay
+    ReplaySink RecordSink;  // where the recording streams to, NULL to keep it in the buffer only
+    const LevelFileHeader* const* Levels;   // played in turn, none for the compiled level
+    int LevelCount;
+    bool Generate;          // a maze made up from the seed for every level, ahead of the level files
+    bool TwoPlayer;         // the first ghost is the second player's, see Game_UpdateMoves()
+} GameConfig;
+
+// The rules, shared with the batched games of src/host/batch.c
+#define GAME_POWER_TICKS        40  // how long a power pellet lasts
+#define GAME_GHOST_SCORE        200
+#define GAME_LIVES              3
+#define GAME_RESPAWN_TICKS      12  // the ghosts can't catch pacman until this many ticks after a respawn
+#define GAME_SPAWN_RADIUS       8   // the ghosts spread over the maze start this far from pacman, rows plus columns
+
+// make MAZEGEN=1 plays generated mazes
+#ifdef PACMAN_MAZEGEN
+#define GAME_GENERATE           true
+#else
+#define GAME_GENERATE           false
+#endif
+
+void Game_Initialize(const GameConfig* config);
+
+// Game_Render() of the state Game_Update() just reached
+#define GAME_ALPHA_ONE          ACTOR_SUBCELL_ONE
+
+// One simulation tick: applies the input, moves the ghosts and resolves the collisions
+void Game_Update();
+
+// Draws a frame alpha (out of GAME_ALPHA_ONE) of the way from the previous
+// tick's state to the current one, and presents it. Doesn't change the
+// simulation's state, only the score popups age by a frame.
+void Game_Render(uint32_t alpha);
+
+// A tick's moves of both players, a Direction each or GAME_MOVE_NONE
+#define GAME_MOVE_NONE          4
+
+typedef struct {
+    uint8_t Pacman;         // one step, like a key press
+    uint8_t Ghost;          // turns the player's ghost, it keeps going that way on its own
+} GameMoves;
+
+// One tick on the moves given instead of the input driver's events, for
+// two-player sessions, which may play a tick more than once
+void Game_UpdateMoves(const GameMoves* moves);
+
+// A tick and its frame, for loops that don't run the two at their own
+// rates. Starts a new frame of the arena (arena.h) first.
+void Game_Step();
+
+uint32_t Game_GetTick();
+uint32_t Game_GetScore();
+uint32_t Game_GetLevel();      // the levels cleared so far
+uint8_t Game_GetLives();
+uint32_t Game_GetGames();      // the games lost so far, a new one starts right away
+bool Game_IsPowered();         // pacman ate a power pellet and it still works
+
+// Ends the recording with the current tick
+void Game_StopRecording();
+
+// Everything the simulation carries from one tick to the next, for a
+// rollback to go back to. The maze comes with the level it belongs to and
+// the pellets, it's loaded again when a rollback crosses a level change.
+typedef struct {
+    uint32_t Tick;
+    uint32_t Score;
+    uint32_t Level;
+    uint32_t Games;
+    uint32_t MazeSerial;    // counts the mazes loaded
+    uint32_t MazeSeed;
+    bool MazeGenerated;
+    uint8_t Lives;
+    uint8_t GhostHeading;
+    uint16_t PowerTicks;
+    uint16_t GraceTicks;
+    RandomState Random;
+    Pellets Pellets;
+    ActorState Actors;
+    GhostState Ghosts;
+} GameState;
+
+void Game_SaveState(GameState* state);
+
+// Puts the simulation back to the saved state and redraws the view
+void Game_LoadState(const GameState* state);
+
+// A hash of everything the simulation carries from one tick to the next,
+// two runs that agree on it every tick played the same game
+uint32_t Game_StateHash();
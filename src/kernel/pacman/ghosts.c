@@ -0,0 +1,194 @@
+#include "ghosts.h"
+#include "actors.h"
+#include "maze.h"
+#include "distance.h"
+#include "level.h"
+#include <debug.h>
+#include <random.h>
+#include <stdint.h>
+
+#define MODULE  "PACMAN"
+
+// True while the maze is the compiled level, then the ghosts route with its tables
+static bool g_RoutingTables;
+
+// The ghost steered by the second player
+static int g_Player = -1;
+
+static GhostState g_State;
+
+// Shortest paths to pacman, shared by all the ghosts, recomputed when he moves.
+// On a large maze they only reach as far as the ghosts are awake.
+static DistanceField g_PacmanDistance;
+static uint16_t g_PacmanDistanceCell;
+static bool g_PacmanDistanceValid;
+
+static const DistanceField* PacmanDistance(uint16_t pacman)
+{
+    if (!g_PacmanDistanceValid || g_PacmanDistanceCell != pacman) {
+#if MAZE_LARGE
+        MazeRect active;
+        Actors_ActiveRect(&active);
+        Distance_FromCellsInRect(&g_PacmanDistance, &pacman, 1, &active);
+#else
+        Distance_FromCell(&g_PacmanDistance, pacman);
+#endif
+        g_PacmanDistanceCell = pacman;
+        g_PacmanDistanceValid = true;
+    }
+    return &g_PacmanDistance;
+}
+
+void Ghosts_Initialize(bool routingTables)
+{
+    g_RoutingTables = routingTables;
+    g_PacmanDistanceValid = false;
+    for (int i = 0; i < ACTOR_MAX; i++)
+        Ghosts_Restart(i);
+#if MAZE_LARGE
+    Distance_Clear(&g_PacmanDistance);
+#endif
+}
+
+void Ghosts_Restart(int actor)
+{
+    CO_RESTART(&g_State.Scripts[actor].Co);
+    g_State.Scripts[actor].Ticks = 0;
+}
+
+void Ghosts_SetPlayer(int actor)
+{
+    g_Player = actor;
+}
+
+// The exits leading closer to pacman, 0 if there is no way to him
+static uint8_t ChaseExits(uint16_t ghost, uint16_t pacman)
+{
+    // the compiled level has the answer in a table
+    if (g_RoutingTables) {
+        if (!Level_Connected(ghost, pacman))
+            return 0;
+        return MAZE_EXIT(Level_NextHop(ghost, pacman));
+    }
+    return Distance_BestExits(PacmanDistance(pacman), ghost);
+}
+
+static void Chase(int ghost, uint16_t pacman)
+{
+    uint16_t cell = g_Actors.Cell[ghost];
+    uint8_t exits = Maze_Exits(cell);
+    if (exits == 0) {
+        log_debug(MODULE, "The ghost is trapped. How is that possible?");
+        return;
+    }
+
+    // in a corridor there is nothing to decide, just don't turn back
+    if (g_RoutingTables && !Level_IsJunction(cell)) {
+        uint8_t forward = exits & ~Actor_BackExit(ghost);
+        if (forward != 0) {
+            Actor_Move(ghost, (Direction)g_ExitDirection[forward][0]);
+            return;
+        }
+    }
+
+    // chase pacman, one draw picks among the equally good exits
+    uint8_t best = ChaseExits(cell, pacman);
+    if (best != 0)
+        exits = best;
+
+    uint8_t n = Random_Below(g_ExitCount[exits]);
+    Actor_Move(ghost, (Direction)g_ExitDirection[exits][n]);
+}
+
+// The arcade's way to a target: never back, and at a fork the exit nearest
+// to it as the crow flies. The target needn't be walkable or reachable, a
+// ghost that can't get there circles around as close as it gets.
+static void Steer(int ghost, int x, int y)
+{
+    uint16_t cell = g_Actors.Cell[ghost];
+    uint8_t exits = Maze_Exits(cell);
+    uint8_t forward = exits & ~Actor_BackExit(ghost);
+    if (forward != 0)
+        exits = forward;
+
+    Direction best = left;
+    int32_t bestDistance = INT32_MAX;
+    for (int n = 0; n < g_ExitCount[exits]; n++) {
+        Direction d = (Direction)g_ExitDirection[exits][n];
+        uint16_t next = Maze_Neighbor(cell, d);
+        int32_t dx = MAZE_X(next) - x, dy = MAZE_Y(next) - y;
+        if (dx * dx + dy * dy < bestDistance) {
+            best = d;
+            bestDistance = dx * dx + dy * dy;
+        }
+    }
+    if (exits != 0)
+        Actor_Move(ghost, best);
+}
+
+// A corner of the awake part of the maze per ghost, all of the maze unless it's large
+static void Scatter(int ghost, const MazeRect* active)
+{
+    int corner = (ghost - ACTOR_FIRST_GHOST) & 3;
+    Steer(ghost, corner & 1 ? active->X : active->X + active->Width - 1,
+        corner & 2 ? active->Y + active->Height - 1 : active->Y);
+}
+
+static void GoHome(int ghost)
+{
+    Steer(ghost, MAZE_X(g_Actors.Spawn[ghost]), MAZE_Y(g_Actors.Spawn[ghost]));
+}
+
+// The script of a ghost, a move per resume
+static void RunScript(int ghost, uint16_t pacman, const MazeRect* active)
+{
+    GhostScript* script = &g_State.Scripts[ghost];
+
+    CO_BEGIN(&script->Co);
+    for (;;) {
+        for (script->Ticks = 0; script->Ticks < GHOST_SCATTER_TICKS; script->Ticks++) {
+            Scatter(ghost, active);
+            CO_YIELD(&script->Co);
+        }
+        for (script->Ticks = 0; script->Ticks < GHOST_CHASE_TICKS; script->Ticks++) {
+            Chase(ghost, pacman);
+            CO_YIELD(&script->Co);
+        }
+        for (script->Ticks = 0; script->Ticks < GHOST_RETURN_TICKS && g_Actors.Cell[ghost] != g_Actors.Spawn[ghost];
+            script->Ticks++) {
+            GoHome(ghost);
+            CO_YIELD(&script->Co);
+        }
+    }
+    CO_END(&script->Co);
+}
+
+void Ghosts_Update()
+{
+    uint16_t pacman = g_Actors.Cell[ACTOR_PACMAN];
+    MazeRect active;
+    Actors_ActiveRect(&active);
+
+    // one pass over the runnable scripts, the sleeping ghosts wait where they are
+#if MAZE_LARGE
+    for (int i = ACTOR_FIRST_GHOST; i < g_Actors.Count; i++)
+        if (i != g_Player && Maze_InRect(&active, g_Actors.Cell[i]))
+            RunScript(i, pacman, &active);
+#else
+    for (int i = ACTOR_FIRST_GHOST; i < g_Actors.Count; i++)
+        if (i != g_Player)
+            RunScript(i, pacman, &active);
+#endif
+}
+
+void Ghosts_Save(GhostState* state)
+{
+    for (int i = 0; i < g_Actors.Count; i++)
+        state->Scripts[i] = g_State.Scripts[i];
+}
+
+void Ghosts_Load(const GhostState* state)
+{
+    for (int i = 0; i < g_Actors.Count; i++)
+        g_State.Scripts[i] = state->Scripts[i];
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include "actors.h"
+#include <util/coroutine.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// Every ghost runs a script, resumed once a tick for one move: out to its
+// corner of the maze for a while, after pacman for longer, then back home
+// to its spawn point, and over again. The moves each part takes, shared
+// with the batched games of src/host/batch.c:
+#define GHOST_SCATTER_TICKS     28
+#define GHOST_CHASE_TICKS       80
+#define GHOST_RETURN_TICKS      40  // the most a ghost tries to get home, it may be cut off
+
+typedef struct {
+    Coroutine Co;
+    uint16_t Ticks;         // into the current part of the script
+} GhostScript;
+
+typedef struct {
+    GhostScript Scripts[ACTOR_MAX];
+} GhostState;
+
+// With routing tables the ghosts use the next hop tables of the compiled
+// level, without them they follow a distance field from pacman. Every
+// script starts from the top.
+void Ghosts_Initialize(bool routingTables);
+
+// The ghost's script from the top, when it's back on its spawn point
+void Ghosts_Restart(int actor);
+
+// The ghost a player steers, Ghosts_Update() leaves it alone. -1 for none.
+void Ghosts_SetPlayer(int actor);
+
+// Resumes the script of every ghost of the actor table, one step each
+void Ghosts_Update();
+
+// The scripts, for a rollback to go back to
+void Ghosts_Save(GhostState* state);
+void Ghosts_Load(const GhostState* state);
@@ -0,0 +1,92 @@
+#include "input.h"
+#include <arch/i686/tsc.h>
+
+#define SCANCODE_EXTENDED       0xE0
+#define SCANCODE_RELEASED       0x80
+
+// Keeps the compiler from moving the slot accesses across the index updates,
+// the CPU doesn't reorder them on x86
+#define COMPILER_BARRIER()      __asm__ volatile ("" ::: "memory")
+
+// Single producer (keyboard IRQ), single consumer (main loop) ring.
+// The indices run freely and are masked on access.
+static InputEvent g_Queue[INPUT_QUEUE_SIZE];
+static volatile uint32_t g_Head;    // written by the producer only
+static volatile uint32_t g_Tail;    // written by the consumer only
+
+static bool g_Overflowing;
+static InputStats g_Stats;
+
+static uint8_t DecodeExtended(uint8_t scancode)
+{
+    switch (scancode & ~SCANCODE_RELEASED) {
+    case 0x4B: return INPUT_KEY_LEFT;
+    case 0x4D: return INPUT_KEY_RIGHT;
+    case 0x48: return INPUT_KEY_UP;
+    case 0x50: return INPUT_KEY_DOWN;
+    default:   return INPUT_KEY_OTHER;
+    }
+}
+
+void Input_OnScancode(uint8_t scancode, uint64_t timestamp)
+{
+    static bool extended = false;
+
+    if (scancode == SCANCODE_EXTENDED) {
+        extended = true;    // the key code follows in the next IRQ
+    }
+    else {
+        uint32_t head = g_Head;
+        uint32_t used = head - g_Tail;
+
+        if (used == INPUT_QUEUE_SIZE) {
+            g_Stats.Dropped++;
+            if (!g_Overflowing)
+                g_Stats.Overflows++;
+            g_Overflowing = true;
+        }
+        else {
+            InputEvent* event = &g_Queue[head & (INPUT_QUEUE_SIZE - 1)];
+            event->Timestamp = timestamp;
+            event->Key = extended ? DecodeExtended(scancode) : INPUT_KEY_OTHER;
+            event->Scancode = scancode;
+            event->Extended = extended;
+            event->Released = (scancode & SCANCODE_RELEASED) != 0;
+
+            COMPILER_BARRIER();
+            g_Head = head + 1;
+
+            g_Overflowing = false;
+            g_Stats.Pushed++;
+            if (used + 1 > g_Stats.HighWater)
+                g_Stats.HighWater = used + 1;
+        }
+        extended = false;
+    }
+
+    uint32_t cycles = (uint32_t)(i686_rdtsc() - timestamp);
+    g_Stats.IrqCount++;
+    g_Stats.IrqTotalCycles += cycles;
+    if (cycles > g_Stats.IrqMaxCycles)
+        g_Stats.IrqMaxCycles = cycles;
+}
+
+bool Input_Pop(InputEvent* event)
+{
+    uint32_t tail = g_Tail;
+    if (tail == g_Head)
+        return false;
+
+    COMPILER_BARRIER();
+    *event = g_Queue[tail & (INPUT_QUEUE_SIZE - 1)];
+    COMPILER_BARRIER();
+    g_Tail = tail + 1;
+
+    g_Stats.Popped++;
+    return true;
+}
+
+const InputStats* Input_GetStats()
+{
+    return &g_Stats;
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+#define INPUT_QUEUE_SIZE        64      // must be a power of 2
+
+// The arrow keys match the engine's Direction
+typedef enum {
+    INPUT_KEY_LEFT  = 0,
+    INPUT_KEY_RIGHT = 1,
+    INPUT_KEY_UP    = 2,
+    INPUT_KEY_DOWN  = 3,
+    INPUT_KEY_OTHER = 4,
+} InputKey;
+
+typedef struct {
+    uint64_t Timestamp;     // rdtsc when the IRQ handler received the scancode
+    uint8_t Key;
+    uint8_t Scancode;
+    bool Extended;
+    bool Released;
+} InputEvent;
+
+typedef struct {
+    uint32_t Pushed;
+    uint32_t Popped;
+    uint32_t Dropped;       // events lost because the queue was full
+    uint32_t Overflows;     // times the queue became full
+    uint32_t HighWater;     // max events waiting in the queue
+    uint32_t IrqCount;
+    uint32_t IrqMaxCycles;  // the longest time spent in Input_OnScancode()
+    uint64_t IrqTotalCycles;
+} InputStats;
+
+// Where the events come from: the keyboard IRQ in the kernel, a script in the host benchmark.
+// Interrupt driven sources push from their handler, the others from Poll().
+typedef struct {
+    const char* Name;
+    void (*Initialize)();
+    void (*Shutdown)();             // stops pushing events, the next driver takes over the queue
+    void (*Poll)(uint32_t tick);    // called by the main loop before it drains the queue
+} InputDriver;
+
+// Producer side, called from the input driver only
+void Input_OnScancode(uint8_t scancode, uint64_t timestamp);
+
+// Consumer side, called from the main loop only
+bool Input_Pop(InputEvent* event);
+const InputStats* Input_GetStats();
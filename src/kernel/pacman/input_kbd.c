@@ -0,0 +1,73 @@
+#include "input_kbd.h"
+#include "profile.h"
+#include <arch/i686/irq.h>
+#include <arch/i686/io.h>
+#include <arch/i686/tsc.h>
+
+#define KBD_DATA_PORT           0x60
+#define KBD_STATUS_PORT         0x64    // reads the status, writes a controller command
+#define KBD_STATUS_OUTPUT_FULL  0x01    // a byte waits for the IRQ handler
+#define KBD_STATUS_INPUT_FULL   0x02    // the controller didn't take the last write yet
+#define KBD_WRITE_OUTPUT        0xD2    // the next data byte comes back as if the keyboard sent it
+#define KBD_WAIT_LOOPS          1000
+
+// Only queues the key, the main loop applies it on the next tick
+static void InputKbd_OnIrq(Registers* regs)
+{
+    PROFILE_BEGIN(IRQ_KBD);
+    uint64_t now = i686_rdtsc();
+    Input_OnScancode(i686_inb(KBD_DATA_PORT), now);
+    PROFILE_END(IRQ_KBD);
+}
+
+// The keyboard keeps its scancode until it's read, so it's read and dropped
+static void InputKbd_Discard(Registers* regs)
+{
+    i686_inb(KBD_DATA_PORT);
+}
+
+static void InputKbd_Initialize()
+{
+    i686_IRQ_RegisterHandler(1, InputKbd_OnIrq);
+}
+
+static void InputKbd_Shutdown()
+{
+    i686_IRQ_RegisterHandler(1, InputKbd_Discard);
+}
+
+static void InputKbd_Poll(uint32_t tick)
+{
+}
+
+static bool InputKbd_WaitInput()
+{
+    for (int i = 0; i < KBD_WAIT_LOOPS; i++)
+        if (!(i686_inb(KBD_STATUS_PORT) & KBD_STATUS_INPUT_FULL))
+            return true;
+    return false;
+}
+
+bool InputKbd_Inject(uint8_t scancode)
+{
+    if (i686_inb(KBD_STATUS_PORT) & (KBD_STATUS_OUTPUT_FULL | KBD_STATUS_INPUT_FULL))
+        return false;
+
+    i686_outb(KBD_STATUS_PORT, KBD_WRITE_OUTPUT);
+    if (!InputKbd_WaitInput())
+        return false;
+    i686_outb(KBD_DATA_PORT, scancode);
+    return true;
+}
+
+static const InputDriver g_InputKbdDriver = {
+    .Name = "PS/2 keyboard",
+    .Initialize = &InputKbd_Initialize,
+    .Shutdown = &InputKbd_Shutdown,
+    .Poll = &InputKbd_Poll,
+};
+
+const InputDriver* InputKbd_GetDriver()
+{
+    return &g_InputKbdDriver;
+}
@@ -0,0 +1,11 @@
+#pragma once
+#include "input.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+// The PS/2 keyboard on IRQ1
+const InputDriver* InputKbd_GetDriver();
+
+// Has the controller hand the scancode back on IRQ1 as if a key was hit,
+// false if the controller is busy with the previous byte
+bool InputKbd_Inject(uint8_t scancode);
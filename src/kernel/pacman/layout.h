@@ -0,0 +1,59 @@
+#pragma once
+#include "render.h"
+
+// make MAZE=<cols>x<rows> for a maze of another size, the compiled level
+// is repeated over it
+#ifdef PACMAN_MAZE_ROWS
+#define NUM_ROWS                PACMAN_MAZE_ROWS
+#else
+#define NUM_ROWS                24
+#endif
+#ifdef PACMAN_MAZE_COLS
+#define NUM_COLS                PACMAN_MAZE_COLS
+#else
+#define NUM_COLS                28
+#endif
+
+// A maze that doesn't fit on the screen is seen through a viewport that
+// follows pacman, and only the actors around him move (see actors.h)
+#define MAZE_LARGE              (NUM_COLS > RENDER_COLS || NUM_ROWS > RENDER_ROWS)
+
+// The cells are kept in square tiles of 2^MAZE_TILE_SHIFT cells a side, row
+// by row inside a tile and tile by tile over the maze, so the cells around
+// pacman share cache lines however wide the maze is. A maze that fits on
+// the screen is small enough for plain rows, 1x1 tiles.
+#ifndef MAZE_TILE_SHIFT
+#if MAZE_LARGE
+#define MAZE_TILE_SHIFT         3
+#else
+#define MAZE_TILE_SHIFT         0
+#endif
+#endif
+#define MAZE_TILE_SIZE          (1 << MAZE_TILE_SHIFT)
+#define MAZE_TILE_MASK          (MAZE_TILE_SIZE - 1)
+#define MAZE_TILES_X            (NUM_COLS >> MAZE_TILE_SHIFT)
+
+#define MAZE_CELLS              (NUM_ROWS * NUM_COLS)
+
+#if (NUM_ROWS & MAZE_TILE_MASK) || (NUM_COLS & MAZE_TILE_MASK)
+#error "A tiled maze has to be a whole number of tiles"
+#endif
+
+#if MAZE_CELLS > 0x10000
+#error "The cells are indexed with 16 bits"
+#endif
+
+#define MAZE_X(index)           (((((index) >> (2 * MAZE_TILE_SHIFT)) % MAZE_TILES_X) << MAZE_TILE_SHIFT) \
+                                 | ((index) & MAZE_TILE_MASK))
+#define MAZE_Y(index)           (((((index) >> (2 * MAZE_TILE_SHIFT)) / MAZE_TILES_X) << MAZE_TILE_SHIFT) \
+                                 | (((index) >> MAZE_TILE_SHIFT) & MAZE_TILE_MASK))
+#define MAZE_INDEX(x, y)        (((((y) >> MAZE_TILE_SHIFT) * MAZE_TILES_X + ((x) >> MAZE_TILE_SHIFT)) << (2 * MAZE_TILE_SHIFT)) \
+                                 | (((y) & MAZE_TILE_MASK) << MAZE_TILE_SHIFT) | ((x) & MAZE_TILE_MASK))
+
+typedef enum { left=0, right=1, up=2, down=3 } Direction;
+
+// A rectangle of cells, in columns and rows
+typedef struct {
+    int X, Y;
+    int Width, Height;
+} MazeRect;
@@ -0,0 +1,67 @@
+#pragma once
+#include "layout.h"
+#include "level_gen.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+// The tables of the level compiled in by build_scripts/level_compiler.c from levels/classic.txt
+
+#define LEVEL_CELLS             (LEVEL_ROWS * LEVEL_COLS)
+#define LEVEL_NEXT_HOP_BYTES    ((LEVEL_WALKABLE + 3) / 4)
+#define LEVEL_NOT_WALKABLE      0xFFFF
+#define LEVEL_NO_JUNCTION       0xFF
+
+// A junction is a dead end or a fork, the cells between them are corridors
+typedef struct {
+    uint16_t Cell;          // in the level's rows, see LEVEL_CELL()
+    uint8_t Next[4];        // the junction at the end of the corridor leaving in each direction
+    uint8_t Length[4];      // the moves it takes to get there
+} LevelJunction;
+
+#if LEVEL_ROWS > NUM_ROWS || LEVEL_COLS > NUM_COLS
+#error "The compiled level doesn't fit in the maze"
+#endif
+
+// The tables route the maze as long as it is the level itself. A larger
+// maze is the level repeated, the ghosts have to search that one.
+#define LEVEL_ROUTES_MAZE       (LEVEL_ROWS == NUM_ROWS && LEVEL_COLS == NUM_COLS)
+
+// The tables are in plain rows of the level's size, whatever order the maze keeps its cells in
+#if LEVEL_ROUTES_MAZE && MAZE_TILE_SHIFT == 0
+#define LEVEL_CELL(index)       (index)
+#else
+#define LEVEL_CELL(index)       (MAZE_Y(index) * LEVEL_COLS + MAZE_X(index))
+#endif
+
+extern const uint8_t g_LevelLandscape[LEVEL_ROWS][LEVEL_COLS];
+
+extern const uint16_t g_LevelWalkableCount;
+extern const uint16_t g_LevelWalkableIndex[LEVEL_CELLS];
+extern const uint8_t g_LevelComponent[LEVEL_WALKABLE];
+
+// The first move of a shortest path between two walkable cells, 2 bits per pair
+extern const uint8_t g_LevelNextHop[LEVEL_WALKABLE][LEVEL_NEXT_HOP_BYTES];
+
+extern const uint8_t g_LevelJunctionCount;
+extern const uint8_t g_LevelCellJunction[LEVEL_CELLS];
+extern const LevelJunction g_LevelJunctions[LEVEL_JUNCTIONS];
+
+static inline bool Level_Connected(int from, int to)
+{
+    uint16_t a = g_LevelWalkableIndex[LEVEL_CELL(from)];
+    uint16_t b = g_LevelWalkableIndex[LEVEL_CELL(to)];
+    return a != LEVEL_NOT_WALKABLE && b != LEVEL_NOT_WALKABLE && g_LevelComponent[a] == g_LevelComponent[b];
+}
+
+// Only meaningful for connected cells
+static inline Direction Level_NextHop(int from, int to)
+{
+    uint16_t a = g_LevelWalkableIndex[LEVEL_CELL(from)];
+    uint16_t b = g_LevelWalkableIndex[LEVEL_CELL(to)];
+    return (Direction)((g_LevelNextHop[a][b >> 2] >> (2 * (b & 3))) & 3);
+}
+
+static inline bool Level_IsJunction(int cell)
+{
+    return g_LevelCellJunction[LEVEL_CELL(cell)] != LEVEL_NO_JUNCTION;
+}
@@ -0,0 +1,60 @@
+#include "level_boot.h"
+#include "level.h"
+#include "maze.h"
+#include "pellets.h"
+#include <arch/i686/tsc.h>
+#include <debug.h>
+#include <stdint.h>
+
+#define MODULE  "LEVEL"
+
+static const LevelFileHeader* g_Levels[LEVEL_BOOT_MAX];
+static int g_LevelCount;
+
+void LevelBoot_Initialize()
+{
+    const LevelBootDirectory* directory = (const LevelBootDirectory*)LEVEL_BOOT_ADDR;
+    uint64_t start;
+
+    g_LevelCount = 0;
+    if (directory->Magic != LEVEL_BOOT_MAGIC || directory->Count > LEVEL_BOOT_MAX) {
+        log_warn(MODULE, "stage2 left no level files");
+        return;
+    }
+
+    // what the files are up against: working the compiled level out from its tiles
+    start = i686_rdtsc();
+    Maze_Load(&g_LevelLandscape[0][0], LEVEL_ROWS, LEVEL_COLS);
+    Pellets_Load();
+    uint32_t compiled = (uint32_t)(i686_rdtsc() - start);
+
+    for (uint32_t i = 0; i < directory->Count; i++) {
+        const LevelBootEntry* entry = &directory->Levels[i];
+        const LevelFileHeader* level = (const LevelFileHeader*)(uintptr_t)entry->Address;
+
+        start = i686_rdtsc();
+        bool valid = LevelFile_Validate(level, entry->Size);
+        uint32_t checked = (uint32_t)(i686_rdtsc() - start);
+        if (!valid) {
+            log_warn(MODULE, "%s rejected", entry->Name);
+            continue;
+        }
+
+        start = i686_rdtsc();
+        LevelFile_Load(level);
+        uint32_t loaded = (uint32_t)(i686_rdtsc() - start);
+
+        log_info(MODULE, "%s: %u bytes, %u spawn points, read %u cycles, checked %u cycles, loaded %u cycles",
+            entry->Name, entry->Size, level->SpawnCount, entry->ReadCycles, checked, loaded);
+        g_Levels[g_LevelCount++] = level;
+    }
+
+    log_info(MODULE, "%u of %u level files usable, the compiled level loads in %u cycles",
+        g_LevelCount, directory->Count, compiled);
+}
+
+const LevelFileHeader* const* LevelBoot_GetLevels(int* count)
+{
+    *count = g_LevelCount;
+    return g_Levels;
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include "level_file.h"
+#include <stdint.h>
+
+// The level files stage2 read from /levels on the floppy, since the kernel
+// has no disk driver. The layout of src/bootloader/stage2/levels.h, at its
+// MEMORY_LEVELS_ADDR.
+#define LEVEL_BOOT_ADDR         0x40000
+#define LEVEL_BOOT_MAGIC        0x5344564C  // "LVDS"
+#define LEVEL_BOOT_MAX          16
+
+typedef struct {
+    char Name[12];
+    uint32_t Address;
+    uint32_t Size;
+    uint32_t ReadCycles;        // reading the file from the disk, in stage2
+} LevelBootEntry;
+
+typedef struct {
+    uint32_t Magic;
+    uint32_t Count;
+    LevelBootEntry Levels[LEVEL_BOOT_MAX];
+} LevelBootDirectory;
+
+// Checks the files stage2 left and logs the time each takes to read, check
+// and load. Once at boot, before the game starts: it loads them into the maze.
+void LevelBoot_Initialize();
+
+// The files that passed the checks, used in place
+const LevelFileHeader* const* LevelBoot_GetLevels(int* count);
@@ -0,0 +1,153 @@
+#include "level_file.h"
+#include "maze.h"
+#include "pellets.h"
+#include <debug.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define MODULE  "LEVEL"
+
+// FNV-1a, the same as build_scripts/level_compiler.c
+static uint32_t Checksum(const uint8_t* data, uint32_t size)
+{
+    uint32_t hash = 2166136261u;
+    for (uint32_t i = 0; i < size; i++)
+        hash = (hash ^ data[i]) * 16777619u;
+    return hash;
+}
+
+// The section lies inside the file and is aligned
+static bool Section(const LevelFileHeader* level, uint32_t offset, uint32_t size)
+{
+    return (offset & 3) == 0 && offset >= level->HeaderSize
+        && offset <= level->Size && size <= level->Size - offset;
+}
+
+// The exits, the neighbors and the bitboards the way Link() in maze.c and
+// Pellets_Load() work them out from the tiles. The engine trusts them, a
+// distance search floods the exit bitboards unmasked, so the file has to
+// have them bit for bit, the padding past the last column clear.
+static bool Consistent(const uint8_t* cells, const uint16_t (*neighbors)[4], const Bitboard* bitboards)
+{
+    static Bitboard expected[LEVEL_BITBOARDS];
+
+    for (int b = 0; b < LEVEL_BITBOARDS; b++)
+        Bitboard_Clear(&expected[b]);
+
+    for (int i = 0; i < MAZE_CELLS; i++) {
+        int x = MAZE_X(i), y = MAZE_Y(i);
+        bool walkable = MAZE_TILE(cells[i]) != TILE_WALL;
+        uint8_t exits = 0;
+
+        for (int d = left; d <= down; d++) {
+            int nx = d == left ? (x + NUM_COLS - 1) % NUM_COLS : d == right ? (x + 1) % NUM_COLS : x;
+            int ny = d == up ? y - 1 : d == down ? y + 1 : y;
+            int next = ny >= 0 && ny < NUM_ROWS ? MAZE_INDEX(nx, ny) : -1;
+            bool open = walkable && next >= 0 && MAZE_TILE(cells[next]) != TILE_WALL;
+
+            if (neighbors[i][d] != (open ? next : i))
+                return false;
+            if (open)
+                exits |= MAZE_EXIT(d);
+        }
+        if (MAZE_EXITS(cells[i]) != exits)
+            return false;
+
+        bool wrapLeft = (exits & MAZE_EXIT(left)) && x == 0;
+        bool wrapRight = (exits & MAZE_EXIT(right)) && x == NUM_COLS - 1;
+        if (walkable)
+            Bitboard_Set(&expected[LEVEL_BITBOARD_WALKABLE], i);
+        if ((exits & MAZE_EXIT(left)) && !wrapLeft)
+            Bitboard_Set(&expected[LEVEL_BITBOARD_EXITS + left], i);
+        if ((exits & MAZE_EXIT(right)) && !wrapRight)
+            Bitboard_Set(&expected[LEVEL_BITBOARD_EXITS + right], i);
+        if (exits & MAZE_EXIT(up))
+            Bitboard_Set(&expected[LEVEL_BITBOARD_EXITS + up], i);
+        if (exits & MAZE_EXIT(down))
+            Bitboard_Set(&expected[LEVEL_BITBOARD_EXITS + down], i);
+        if (wrapLeft)
+            Bitboard_Set(&expected[LEVEL_BITBOARD_WRAP_LEFT], i);
+        if (wrapRight)
+            Bitboard_Set(&expected[LEVEL_BITBOARD_WRAP_RIGHT], i);
+        if (MAZE_TILE(cells[i]) == TILE_DOT)
+            Bitboard_Set(&expected[LEVEL_BITBOARD_DOTS], i);
+        if (MAZE_TILE(cells[i]) == TILE_POWER)
+            Bitboard_Set(&expected[LEVEL_BITBOARD_POWERS], i);
+    }
+
+    for (int b = 0; b < LEVEL_BITBOARDS; b++)
+        for (int w = 0; w < BITBOARD_WORDS; w++)
+            if (bitboards[b].Words[w] != expected[b].Words[w])
+                return false;
+    return true;
+}
+
+static bool Fail(const char* reason)
+{
+    log_warn(MODULE, "not a level: %s", reason);
+    return false;
+}
+
+bool LevelFile_Validate(const void* data, uint32_t size)
+{
+    const LevelFileHeader* level = (const LevelFileHeader*)data;
+
+    if (size < sizeof(LevelFileHeader) || level->Magic != LEVEL_FILE_MAGIC)
+        return Fail("no magic");
+    if (level->Version != LEVEL_FILE_VERSION || level->HeaderSize < sizeof(LevelFileHeader))
+        return Fail("unknown version");
+    if (level->Size > size || level->HeaderSize > level->Size)
+        return Fail("truncated");
+    if (level->Rows != NUM_ROWS || level->Cols != NUM_COLS || level->RowBits != BITBOARD_ROW_BITS)
+        return Fail("the maze size doesn't match the engine's");
+    if (MAZE_TILE_SHIFT != 0)
+        return Fail("the file has the maze in rows, the engine in tiles");
+
+    if (!Section(level, level->CellsOffset, MAZE_CELLS)
+            || !Section(level, level->NeighborsOffset, MAZE_CELLS * 4 * sizeof(uint16_t))
+            || !Section(level, level->BitboardsOffset, LEVEL_BITBOARDS * sizeof(Bitboard))
+            || !Section(level, level->SpawnsOffset, level->SpawnCount * sizeof(LevelFileSpawn)))
+        return Fail("a section is out of the file");
+
+    const uint8_t* bytes = (const uint8_t*)data;
+    if (Checksum(bytes + level->HeaderSize, level->Size - level->HeaderSize) != level->Checksum)
+        return Fail("bad checksum");
+
+    // nothing in the file may take the engine out of the maze
+    const uint8_t* cells = bytes + level->CellsOffset;
+    const uint16_t* neighbors = (const uint16_t*)(bytes + level->NeighborsOffset);
+    for (int i = 0; i < MAZE_CELLS; i++)
+        if (MAZE_TILE(cells[i]) > TILE_DOOR)
+            return Fail("unknown tile");
+    for (int i = 0; i < MAZE_CELLS * 4; i++)
+        if (neighbors[i] >= MAZE_CELLS)
+            return Fail("a neighbor is out of the maze");
+
+    const Bitboard* bitboards = (const Bitboard*)(bytes + level->BitboardsOffset);
+    if (!Consistent(cells, (const uint16_t (*)[4])neighbors, bitboards))
+        return Fail("the exits, the neighbors or the bitboards don't match the tiles");
+    if (Bitboard_Count(&bitboards[LEVEL_BITBOARD_DOTS]) + Bitboard_Count(&bitboards[LEVEL_BITBOARD_POWERS]) != level->Pellets)
+        return Fail("the pellets don't add up");
+
+    const LevelFileSpawn* spawns = LevelFile_Spawns(level);
+    bool pacman = false;
+    for (int i = 0; i < level->SpawnCount; i++) {
+        if (spawns[i].Cell >= MAZE_CELLS || MAZE_TILE(cells[spawns[i].Cell]) == TILE_WALL)
+            return Fail("a spawn point is off the paths");
+        pacman |= spawns[i].Kind == LEVEL_SPAWN_PACMAN;
+    }
+    if (!pacman)
+        return Fail("no spawn point for pacman");
+
+    return true;
+}
+
+void LevelFile_Load(const LevelFileHeader* level)
+{
+    const uint8_t* bytes = (const uint8_t*)level;
+    const Bitboard* bitboards = (const Bitboard*)(bytes + level->BitboardsOffset);
+
+    Maze_LoadPrecomputed(bytes + level->CellsOffset,
+        (const uint16_t (*)[4])(bytes + level->NeighborsOffset), bitboards);
+    Pellets_LoadBitboards(&bitboards[LEVEL_BITBOARD_DOTS], &bitboards[LEVEL_BITBOARD_POWERS]);
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+// A level as a file (levels/*.lvl on the floppy), written by
+// build_scripts/level_compiler.c --binary. Besides the tiles it carries
+// everything Maze_Load() and Pellets_Load() would work out, laid out the way
+// the engine keeps it, so loading a level is copying the sections, no parsing.
+//
+// Little endian, every offset is from the start of the file and 4 byte
+// aligned. Readers take newer files of the same version if the header grew,
+// the sections are found by their offsets.
+
+#define LEVEL_FILE_MAGIC        0x4C564C50  // "PLVL"
+#define LEVEL_FILE_VERSION      1
+
+// The spawn kinds are the numbers of the text mazes' landscape
+#define LEVEL_SPAWN_GHOST       5           // 5..8, the ghost colors
+#define LEVEL_SPAWN_GHOST_KINDS 4
+#define LEVEL_SPAWN_PACMAN      9
+
+// The bitboards of the file, in this order
+enum {
+    LEVEL_BITBOARD_WALKABLE,
+    LEVEL_BITBOARD_EXITS,                   // 4 of them, left, right, up, down
+    LEVEL_BITBOARD_WRAP_LEFT = LEVEL_BITBOARD_EXITS + 4,
+    LEVEL_BITBOARD_WRAP_RIGHT,
+    LEVEL_BITBOARD_DOTS,
+    LEVEL_BITBOARD_POWERS,
+    LEVEL_BITBOARDS,
+};
+
+typedef struct {
+    uint32_t Magic;
+    uint16_t Version;
+    uint16_t HeaderSize;
+    uint32_t Size;              // the whole file
+    uint32_t Checksum;          // FNV-1a of everything after the header
+    uint8_t Rows;
+    uint8_t Cols;
+    uint8_t RowBits;            // bits per row in the bitboards, BITBOARD_ROW_BITS
+    uint8_t SpawnCount;
+    uint16_t Walkable;          // walkable cells
+    uint16_t Pellets;           // dots and power pellets
+    uint32_t CellsOffset;       // Rows * Cols bytes, a tile in the low nibble and the exits in the high one
+    uint32_t NeighborsOffset;   // Rows * Cols * 4 uint16_t, the cell itself for a blocked direction
+    uint32_t BitboardsOffset;   // LEVEL_BITBOARDS of (Rows + 1) / 2 uint64_t each
+    uint32_t SpawnsOffset;      // SpawnCount LevelFileSpawn, pacman's among them
+} LevelFileHeader;
+
+typedef struct {
+    uint16_t Cell;
+    uint8_t Kind;
+    uint8_t Reserved;
+} LevelFileSpawn;
+
+// Checks the file can be loaded as it is: the magic, the version, the maze
+// size against the engine's, the sections inside the file, the checksum,
+// that every cell index is in the maze and that the exits, the neighbors
+// and the bitboards are the ones the tiles make
+bool LevelFile_Validate(const void* data, uint32_t size);
+
+// Copies a valid level into the maze and the pellets
+void LevelFile_Load(const LevelFileHeader* level);
+
+static inline const LevelFileSpawn* LevelFile_Spawns(const LevelFileHeader* level)
+{
+    return (const LevelFileSpawn*)((const uint8_t*)level + level->SpawnsOffset);
+}
@@ -0,0 +1,545 @@
+// !!! THIS FILE IS AUTOGENERATED from levels/classic.txt by build_scripts/level_compiler.c !!!
+#include "level.h"
+
+const uint8_t g_LevelLandscape[LEVEL_ROWS][LEVEL_COLS] = {
+    { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 },
+    { 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1 },
+    { 1, 2, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 2, 1, 1, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 2, 1 },
+    { 1, 3, 1, 0, 0, 1, 2, 1, 0, 0, 0, 1, 2, 1, 1, 2, 1, 0, 0, 0, 1, 2, 1, 0, 0, 1, 3, 1 },
+    { 1, 2, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 2, 1, 1, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 2, 1 },
+    { 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1 },
+    { 1, 2, 1, 1, 1, 1, 2, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 2, 1, 1, 1, 1, 2, 1 },
+    { 1, 2, 2, 2, 2, 2, 2, 1, 1, 2, 2, 2, 2, 1, 1, 2, 2, 2, 2, 1, 1, 2, 2, 2, 2, 2, 2, 1 },
+    { 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1 },
+    { 0, 0, 0, 0, 0, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 1, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 1, 2, 1, 1, 0, 1, 1, 1, 4, 4, 1, 1, 1, 0, 1, 1, 2, 1, 0, 0, 0, 0, 0 },
+    { 1, 1, 1, 1, 1, 1, 2, 1, 1, 0, 1, 0, 0, 0, 6, 5, 0, 1, 0, 0, 0, 2, 1, 1, 1, 1, 1, 1 },
+    { 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 8, 7, 0, 0, 0, 1, 0, 1, 1, 2, 0, 0, 0, 0, 0, 0 },
+    { 1, 1, 1, 1, 1, 1, 2, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 2, 1, 1, 1, 1, 1, 1 },
+    { 0, 0, 0, 0, 0, 1, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 1, 0, 0, 0, 0, 0 },
+    { 1, 1, 1, 1, 1, 1, 2, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 2, 1, 1, 1, 1, 1, 1 },
+    { 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1 },
+    { 1, 2, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 2, 1, 1, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 2, 1 },
+    { 1, 3, 2, 2, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 9, 2, 2, 2, 2, 2, 2, 2, 1, 1, 2, 2, 3, 1 },
+    { 1, 1, 1, 2, 1, 1, 2, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 2, 1, 1, 2, 1, 1, 1 },
+    { 1, 2, 2, 2, 2, 2, 2, 1, 1, 2, 2, 2, 2, 1, 1, 2, 2, 2, 2, 1, 1, 2, 2, 2, 2, 2, 2, 1 },
+    { 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1 },
+    { 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1 },
+    { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 },
+};
+
+const uint16_t g_LevelWalkableCount = 320;
+
+const uint16_t g_LevelWalkableIndex[LEVEL_CELLS] = {
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 0, 1, 2,
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 65535, 65535, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 65535, 65535, 24, 65535, 65535, 65535, 65535, 25, 65535,
+    65535, 65535, 65535, 65535, 26, 65535, 65535, 27, 65535, 65535, 65535, 65535, 65535, 28, 65535, 65535,
+    65535, 65535, 29, 65535, 65535, 30, 65535, 31, 32, 65535, 33, 65535, 34, 35, 36, 65535,
+    37, 65535, 65535, 38, 65535, 39, 40, 41, 65535, 42, 65535, 43, 44, 65535, 45, 65535,
+    65535, 46, 65535, 65535, 65535, 65535, 47, 65535, 65535, 65535, 65535, 65535, 48, 65535, 65535, 49,
+    65535, 65535, 65535, 65535, 65535, 50, 65535, 65535, 65535, 65535, 51, 65535, 65535, 52, 53, 54,
+    55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70,
+    71, 72, 73, 74, 75, 76, 77, 65535, 65535, 78, 65535, 65535, 65535, 65535, 79, 65535,
+    65535, 80, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 81, 65535, 65535, 82, 65535, 65535,
+    65535, 65535, 83, 65535, 65535, 84, 85, 86, 87, 88, 89, 65535, 65535, 90, 91, 92,
+    93, 65535, 65535, 94, 95, 96, 97, 65535, 65535, 98, 99, 100, 101, 102, 103, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 104, 65535, 65535, 65535, 65535, 65535, 105, 65535, 65535, 106,
+    65535, 65535, 65535, 65535, 65535, 107, 65535, 65535, 65535, 65535, 65535, 65535, 108, 109, 110, 111,
+    112, 65535, 113, 65535, 65535, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 65535,
+    65535, 124, 65535, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 65535, 135, 65535,
+    65535, 136, 65535, 65535, 65535, 137, 138, 65535, 65535, 65535, 139, 65535, 65535, 140, 65535, 141,
+    142, 143, 144, 145, 65535, 65535, 65535, 65535, 65535, 65535, 146, 65535, 65535, 147, 65535, 148,
+    149, 150, 151, 152, 153, 65535, 154, 155, 156, 157, 65535, 65535, 65535, 65535, 65535, 65535,
+    158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 65535, 168, 169, 170, 171, 172,
+    173, 65535, 174, 65535, 65535, 175, 176, 177, 178, 179, 180, 181, 65535, 65535, 65535, 65535,
+    65535, 65535, 182, 65535, 65535, 183, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 184, 65535,
+    65535, 185, 65535, 65535, 65535, 65535, 65535, 65535, 186, 187, 188, 189, 190, 65535, 191, 65535,
+    65535, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 65535, 65535, 202, 65535, 203,
+    204, 205, 206, 207, 65535, 65535, 65535, 65535, 65535, 65535, 208, 65535, 65535, 209, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 210, 65535, 65535, 211, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 65535, 65535, 224,
+    225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 65535, 65535, 236, 65535, 65535,
+    65535, 65535, 237, 65535, 65535, 65535, 65535, 65535, 238, 65535, 65535, 239, 65535, 65535, 65535, 65535,
+    65535, 240, 65535, 65535, 65535, 65535, 241, 65535, 65535, 242, 243, 244, 65535, 65535, 245, 246,
+    247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 65535, 65535,
+    261, 262, 263, 65535, 65535, 65535, 65535, 264, 65535, 65535, 265, 65535, 65535, 266, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 267, 65535, 65535, 268, 65535, 65535, 269, 65535, 65535, 65535,
+    65535, 270, 271, 272, 273, 274, 275, 65535, 65535, 276, 277, 278, 279, 65535, 65535, 280,
+    281, 282, 283, 65535, 65535, 284, 285, 286, 287, 288, 289, 65535, 65535, 290, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 291, 65535, 65535, 292, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 293, 65535, 65535, 294, 295, 296, 297, 298, 299, 300,
+    301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316,
+    317, 318, 319, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535
+};
+
+const uint8_t g_LevelComponent[LEVEL_WALKABLE] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    1, 0, 2, 2, 2, 0, 0, 3, 3, 3, 0, 4, 4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 5, 5,
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 5, 5, 5,
+    5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+const uint8_t g_LevelNextHop[LEVEL_WALKABLE][LEVEL_NEXT_HOP_BYTES] = {
+    { 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x57, 0x35, 0x04, 0x14, 0x10, 0x74, 0x55, 0xff, 0x57, 0x55, 0x55, 0x55, 0x55, 0x75, 0x55, 0xff, 0x57, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0x04, 0x14, 0x10, 0x44, 0x55, 0x00, 0x54, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x00, 0x54, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0x04, 0x14, 0x10, 0x44, 0x55, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0x04, 0x14, 0x10, 0x44, 0x55, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x54, 0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0x04, 0x14, 0x10, 0x44, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x50, 0x55, 0x55, 0x55, 0x55, 0x5c, 0x05, 0x0c, 0x14, 0x10, 0xc4, 0x55, 0xfc, 0xff, 0x7f, 0x55, 0x55, 0x55, 0xc5, 0x57, 0xfc, 0xff, 0x7f, 0x55, 0x55, 0x7f, 0x00, 0xfc, 0xff, 0xff, 0x01, 0x00, 0xc0, 0xff, 0x01, 0xf0, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x14, 0x10, 0x04, 0x55, 0x00, 0x00, 0x40, 0x55, 0x55, 0x55, 0x05, 0x54, 0x00, 0x00, 0x40, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x14, 0x10, 0x04, 0x55, 0x00, 0x00, 0x50, 0x55, 0x55, 0x55, 0x05, 0x54, 0x00, 0x00, 0x50, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x40, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50 },
+    { 0x00, 0x00, 0x54, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x14, 0x10, 0x04, 0x55, 0x00, 0x00, 0x54, 0x55, 0x55, 0x55, 0x05, 0x54, 0x00, 0x00, 0x50, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x05, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x50, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54 },
+    { 0x00, 0x00, 0x50, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x14, 0x10, 0x04, 0x55, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x00, 0x50, 0x55, 0x55, 0x55, 0x54, 0x00, 0x50, 0x55, 0x55, 0x01, 0x00, 0x00, 0x54, 0x01, 0x00, 0x55, 0x55, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x14, 0x00, 0x50, 0x00, 0x00, 0x00, 0x54, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x54, 0x55, 0x40, 0x05, 0x00, 0x00, 0x54, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55 },
+    { 0x00, 0x00, 0x40, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x14, 0x10, 0x04, 0x55, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x00, 0x50, 0x55, 0x55, 0x55, 0x54, 0x00, 0x50, 0x55, 0x55, 0x01, 0x00, 0x00, 0x55, 0x01, 0x00, 0x55, 0x55, 0x05, 0x00, 0x00, 0x55, 0x55, 0x15, 0x00, 0x05, 0x00, 0x00, 0x00, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x55 },
+    { 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0x00, 0x3c, 0x30, 0x0c, 0xff, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xfc, 0x00, 0xf0, 0xff, 0xff, 0x03, 0x00, 0x00, 0xff, 0x03, 0xc0, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x0f, 0x00, 0x00, 0xc0, 0x3f, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xc0, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff },
+    { 0xff, 0xff, 0xff, 0x54, 0x55, 0x55, 0xff, 0x35, 0x0c, 0x3c, 0x10, 0xf4, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xf5, 0x5f, 0xff, 0xff, 0xff, 0x5f, 0x55, 0x7f, 0x00, 0xfc, 0xff, 0xff, 0x01, 0x00, 0xc0, 0xff, 0x01, 0xf0, 0xff, 0x5f, 0x55, 0xff, 0xff, 0xff, 0x5f, 0x55, 0xf5, 0x05, 0xc0, 0x7f, 0x55, 0x15, 0x00, 0x5f, 0xff, 0xff, 0xff, 0x55, 0x55, 0x55, 0x7f, 0xf5, 0xff, 0x7f, 0x55, 0x55, 0x55, 0x7f, 0xf5, 0xff, 0xff, 0x55, 0x55, 0xf5, 0xf5, 0xff, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x10, 0x04, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x05, 0x50, 0x00, 0x00, 0x00, 0x50, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x50, 0x55, 0x00, 0x00, 0x00, 0x50, 0x55, 0x05, 0x05, 0x00, 0x40, 0x55, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x40, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05, 0x05, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x40, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x10, 0x04, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0x55, 0x05, 0x50, 0x00, 0x00, 0x00, 0x50, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x50, 0x55, 0x01, 0x00, 0x00, 0x50, 0x55, 0x05, 0x05, 0x00, 0x50, 0x55, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x50, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x45, 0x05, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x10, 0x04, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x05, 0x50, 0x00, 0x00, 0x00, 0x50, 0x55, 0x40, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x50, 0x55, 0x05, 0x00, 0x00, 0x50, 0x55, 0x05, 0x05, 0x00, 0x54, 0x55, 0x15, 0x00, 0x50, 0x00, 0x00, 0x40, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x54, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x40, 0x55, 0x55, 0x45, 0x05, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x00, 0x05, 0x00, 0x00, 0x10, 0x04, 0x50, 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x05, 0x54, 0x00, 0x00, 0x50, 0x55, 0x55, 0x50, 0x00, 0x50, 0x55, 0x55, 0x01, 0x00, 0x00, 0x55, 0x01, 0x40, 0x55, 0x55, 0x55, 0x15, 0x40, 0x55, 0x55, 0x55, 0x45, 0x05, 0x00, 0x55, 0x55, 0x15, 0x00, 0x54, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x55, 0x55, 0x55, 0x45, 0x05, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x00, 0x05, 0x00, 0x00, 0x10, 0x04, 0x50, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x05, 0x54, 0x00, 0x00, 0x50, 0x55, 0x55, 0x54, 0x00, 0x50, 0x55, 0x55, 0x01, 0x00, 0x00, 0x55, 0x01, 0x40, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x55, 0x55, 0x45, 0x05, 0x00, 0x55, 0x55, 0x15, 0x00, 0x54, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x40, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x55, 0x55, 0x55, 0x45, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x40, 0x55, 0x00, 0x07, 0x00, 0x00, 0x30, 0x04, 0x70, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff, 0x07, 0x7c, 0x00, 0x00, 0xfc, 0xff, 0x7f, 0xfc, 0x00, 0xf0, 0xff, 0xff, 0x03, 0x00, 0x00, 0xff, 0x03, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xaa, 0xaa, 0xaa, 0xff, 0xff, 0xff, 0xe8, 0x3f, 0x08, 0x38, 0x30, 0xbc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x03, 0x00, 0xc0, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xff, 0xff, 0xff, 0xe2, 0x2f, 0x0c, 0x38, 0x30, 0xec, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x03, 0x00, 0xc0, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xff, 0xff, 0xff, 0xca, 0x2f, 0x08, 0x3c, 0x30, 0xac, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x03, 0x00, 0xc0, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0xff, 0xaa, 0xaa, 0xaa, 0x3f, 0x3a, 0x0c, 0x3c, 0x20, 0xf8, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x03, 0x00, 0xc0, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0xff, 0xaa, 0xaa, 0xaa, 0xbf, 0x38, 0x0c, 0x2c, 0x30, 0xf8, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x03, 0x00, 0xc0, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0xff, 0xaa, 0xaa, 0xaa, 0xbf, 0x32, 0x0c, 0x2c, 0x20, 0xfc, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x03, 0x00, 0xc0, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xff, 0xff, 0xff, 0xea, 0x0f, 0x08, 0x38, 0x30, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x03, 0x00, 0xc0, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xaa, 0xaa, 0xaa, 0xff, 0xff, 0xff, 0xea, 0x2f, 0x00, 0x38, 0x30, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x03, 0x00, 0xc0, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xaa, 0xaa, 0xaa, 0xff, 0xff, 0xff, 0xea, 0x2f, 0x08, 0x30, 0x30, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x03, 0x00, 0xc0, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0xff, 0xaa, 0xaa, 0xaa, 0xbf, 0x3a, 0x0c, 0x0c, 0x20, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x03, 0x00, 0xc0, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xaa, 0xaa, 0xaa, 0xbf, 0x3a, 0x0c, 0x2c, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x03, 0x00, 0xc0, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xaa, 0xaa, 0xaa, 0xbf, 0x3a, 0x0c, 0x2c, 0x20, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x03, 0x00, 0xc0, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xff, 0xff, 0xff, 0xea, 0x2f, 0x0c, 0x3c, 0x30, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x03, 0x00, 0xc0, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xff, 0xff, 0xff, 0xea, 0x3f, 0x08, 0x3c, 0x30, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x03, 0x00, 0xc0, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xff, 0xff, 0xff, 0xea, 0x3f, 0x0c, 0x38, 0x30, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x03, 0x00, 0xc0, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0xff, 0xaa, 0xaa, 0xaa, 0xbf, 0x3a, 0x0c, 0x2c, 0x30, 0xfc, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x03, 0x00, 0xc0, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0xff, 0xaa, 0xaa, 0xaa, 0xbf, 0x3a, 0x0c, 0x3c, 0x20, 0xfc, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x03, 0x00, 0xc0, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0xff, 0xaa, 0xaa, 0xaa, 0xbf, 0x3a, 0x0c, 0x3c, 0x30, 0xf8, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x03, 0x00, 0xc0, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0x56, 0x55, 0x55, 0x55, 0x55, 0x56, 0x25, 0x04, 0x14, 0x10, 0x64, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x75, 0x55, 0xff, 0x57, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x54, 0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0x04, 0x14, 0x10, 0x44, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x00, 0x54, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0x04, 0x14, 0x10, 0x44, 0x55, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0x04, 0x14, 0x10, 0x44, 0x55, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0x04, 0x14, 0x10, 0x44, 0x55, 0x00, 0x54, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0xa8, 0xaa, 0x6a, 0x55, 0x55, 0x55, 0x58, 0x05, 0x08, 0x14, 0x10, 0x84, 0x55, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55, 0xc5, 0x55, 0xfc, 0x5f, 0x55, 0x55, 0x55, 0x57, 0x00, 0x5c, 0x55, 0x55, 0x01, 0x00, 0xc0, 0x57, 0x01, 0xf0, 0x55, 0x55, 0xf5, 0xff, 0xff, 0x55, 0xd5, 0xff, 0xff, 0x0d, 0xc0, 0xff, 0xff, 0x37, 0x00, 0xdf, 0xff, 0xff, 0xff, 0x57, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x00, 0x40, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x14, 0x10, 0x04, 0x55, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x00, 0x50, 0x55, 0x55, 0x55, 0x54, 0x00, 0x50, 0x55, 0x55, 0x01, 0x00, 0x00, 0x54, 0x01, 0x00, 0x55, 0x55, 0x05, 0x00, 0x00, 0x55, 0x15, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x54, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x50, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x14, 0x10, 0x04, 0x55, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x00, 0x50, 0x55, 0x55, 0x55, 0x54, 0x00, 0x50, 0x55, 0x55, 0x01, 0x00, 0x00, 0x55, 0x01, 0x00, 0x55, 0x55, 0x05, 0x00, 0x00, 0x55, 0x55, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x40, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50 },
+    { 0x00, 0x00, 0x54, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x14, 0x10, 0x04, 0x55, 0x00, 0x00, 0x54, 0x55, 0x55, 0x55, 0x05, 0x57, 0x00, 0xf0, 0x7f, 0x55, 0x55, 0x7c, 0x00, 0xf0, 0xff, 0xff, 0x01, 0x00, 0x00, 0xff, 0x01, 0xc0, 0xff, 0xff, 0x07, 0x00, 0x00, 0xff, 0x7f, 0x01, 0x00, 0x07, 0x00, 0x00, 0xc0, 0x1f, 0x00, 0x70, 0x00, 0x00, 0x00, 0xff, 0x5f, 0x55, 0xc0, 0x05, 0x00, 0x00, 0x00, 0x50, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54 },
+    { 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x14, 0x10, 0x04, 0x55, 0x00, 0x00, 0x50, 0x55, 0x55, 0x55, 0x05, 0x54, 0x00, 0x00, 0x40, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x54, 0x55, 0x40, 0x05, 0x00, 0x00, 0x54, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55 },
+    { 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x14, 0x10, 0x04, 0x55, 0x00, 0x00, 0x40, 0x55, 0x55, 0x55, 0x05, 0x54, 0x00, 0x00, 0x50, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x40, 0x15, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x55 },
+    { 0x00, 0xa0, 0xaa, 0x55, 0x55, 0x55, 0x60, 0x05, 0x00, 0x18, 0x10, 0x04, 0x56, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x05, 0x54, 0x00, 0x00, 0x50, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x05, 0x00, 0x00, 0x00, 0x40, 0x55, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x40, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55 },
+    { 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x10, 0x10, 0x04, 0x54, 0x00, 0x00, 0x00, 0x54, 0x55, 0x55, 0x05, 0x54, 0x00, 0x00, 0x50, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x55, 0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0x00, 0x50, 0x55, 0x01, 0x05, 0x00, 0x00, 0x50, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x50, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05, 0x05, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x10, 0x10, 0x04, 0x54, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x05, 0x54, 0x00, 0x00, 0x50, 0x55, 0x55, 0x50, 0x00, 0x00, 0x40, 0x55, 0x01, 0x00, 0x00, 0x50, 0x01, 0x00, 0x40, 0x55, 0x05, 0x00, 0x00, 0x40, 0x55, 0x55, 0x05, 0x05, 0x00, 0x00, 0x54, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x54, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05, 0x05, 0x00, 0x00, 0x40, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0xaa, 0x5a, 0x55, 0x80, 0x05, 0x00, 0x20, 0x10, 0x04, 0x58, 0x00, 0x00, 0x00, 0x40, 0x55, 0x55, 0x05, 0x54, 0x00, 0x00, 0x50, 0x55, 0x55, 0x50, 0x00, 0x00, 0x50, 0x55, 0x01, 0x00, 0x00, 0x54, 0x01, 0x00, 0x55, 0x55, 0x15, 0x00, 0x00, 0x55, 0x55, 0x55, 0x05, 0x05, 0x00, 0x00, 0x55, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05, 0x05, 0x00, 0x00, 0x50, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x00, 0x05, 0x00, 0x00, 0x10, 0x04, 0x50, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x05, 0x54, 0x00, 0x00, 0x50, 0x55, 0x55, 0x50, 0x00, 0x50, 0x55, 0x55, 0x01, 0x00, 0x00, 0x55, 0x01, 0x40, 0x55, 0x55, 0x55, 0x00, 0x40, 0x55, 0x55, 0x55, 0x45, 0x05, 0x00, 0x55, 0x55, 0x15, 0x00, 0x54, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x40, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05, 0x05, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x00, 0x05, 0x00, 0x00, 0x10, 0x04, 0x50, 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x05, 0x54, 0x00, 0x00, 0x50, 0x55, 0x55, 0x54, 0x00, 0x50, 0x55, 0x55, 0x01, 0x00, 0x00, 0x55, 0x01, 0x40, 0x55, 0x55, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x45, 0x05, 0x00, 0x55, 0x55, 0x15, 0x00, 0x54, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x50, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x45, 0x05, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x10, 0x04, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x05, 0x5c, 0x00, 0x00, 0xfc, 0x5f, 0x55, 0x7c, 0x00, 0xf0, 0xff, 0xff, 0x01, 0x00, 0x00, 0xff, 0x01, 0xc0, 0xff, 0x5f, 0x55, 0x05, 0xfc, 0xff, 0x5f, 0x55, 0xc5, 0x05, 0x00, 0x7f, 0x55, 0x15, 0x00, 0x5c, 0x00, 0xf0, 0xff, 0x55, 0x55, 0x55, 0x70, 0x05, 0x00, 0x54, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x40, 0x55, 0x55, 0x45, 0x05, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x40, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x10, 0x04, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0x55, 0x05, 0x50, 0x00, 0x00, 0x00, 0x50, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x50, 0x55, 0x15, 0x00, 0x00, 0x50, 0x55, 0x05, 0x05, 0x00, 0x40, 0x55, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x55, 0x55, 0x55, 0x45, 0x05, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x10, 0x04, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x05, 0x50, 0x00, 0x00, 0x00, 0x50, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x50, 0x55, 0x55, 0x00, 0x00, 0x50, 0x55, 0x05, 0x05, 0x00, 0x50, 0x55, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x50, 0x05, 0x40, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x55, 0x55, 0x55, 0x45, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0xa8, 0xaa, 0x6a, 0x00, 0x06, 0x00, 0x00, 0x20, 0x04, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x05, 0x70, 0x00, 0x00, 0x00, 0xf0, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x03, 0x00, 0xf0, 0xff, 0x3f, 0x0f, 0xc0, 0xfc, 0xff, 0x3f, 0x00, 0xf3, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x80, 0xaa, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x8a, 0xaa, 0xff, 0xaf, 0xaa, 0xaa, 0xaa, 0xab, 0x00, 0xbc, 0xaa, 0xaa, 0x02, 0x00, 0xc0, 0xab, 0x02, 0xf0, 0xaa, 0xaa, 0xfe, 0xff, 0xff, 0xaa, 0xea, 0xff, 0xff, 0x0e, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0xff, 0xaf, 0xaa, 0xaa, 0xaa, 0xab, 0x00, 0xbc, 0xaa, 0xaa, 0x02, 0x00, 0xc0, 0xab, 0x02, 0xf0, 0xaa, 0xaa, 0xfe, 0xff, 0xff, 0xaa, 0xea, 0xff, 0xff, 0x0e, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0xaa, 0xfa, 0xff, 0xaa, 0xaa, 0xbe, 0x00, 0xf8, 0xff, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0xe0, 0xff, 0xff, 0xaf, 0xaa, 0xea, 0xff, 0xff, 0xaf, 0xea, 0x0f, 0x80, 0xff, 0xff, 0x3f, 0x00, 0xfe, 0xaa, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xaf, 0xaa, 0xea, 0xff, 0xff, 0xff, 0xea, 0xaf, 0xaa, 0xaa, 0xfe, 0xff, 0xaf, 0xae, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa2, 0xaa, 0xaa, 0xff, 0xaf, 0xaa, 0xbe, 0x00, 0xf8, 0xff, 0xff, 0x02, 0x00, 0x80, 0xff, 0x02, 0xe0, 0xff, 0xbf, 0xaa, 0xfa, 0xff, 0xff, 0xbf, 0xaa, 0xfa, 0x0b, 0xc0, 0xff, 0xff, 0x2f, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xaa, 0xaa, 0xff, 0xfa, 0xff, 0xff, 0xbf, 0xaa, 0xaa, 0xbf, 0xfa, 0xff, 0xbf, 0xaa, 0xaa, 0xba, 0xfa, 0xaf, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x8a, 0xaa, 0xaa, 0xaa, 0xfa, 0xff, 0xea, 0x00, 0xa8, 0xaa, 0xfa, 0x03, 0x00, 0x80, 0xea, 0x03, 0xb0, 0xaa, 0xfa, 0xff, 0xff, 0xaf, 0xaa, 0xfa, 0xff, 0xbf, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0xaa, 0xaa, 0xfa, 0xff, 0xea, 0x00, 0xa8, 0xaa, 0xfa, 0x03, 0x00, 0x80, 0xea, 0x03, 0xb0, 0xaa, 0xfa, 0xff, 0xff, 0xaf, 0xaa, 0xfa, 0xff, 0xbf, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0x56, 0x55, 0x55, 0x55, 0x55, 0x56, 0x25, 0x04, 0x14, 0x10, 0x64, 0x55, 0xaa, 0x56, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x54, 0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0x04, 0x14, 0x10, 0x44, 0x55, 0x00, 0x54, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0x04, 0x14, 0x10, 0x44, 0x55, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0x04, 0x14, 0x10, 0x44, 0x55, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0x04, 0x14, 0x10, 0x44, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x00, 0x54, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0x0a, 0x08, 0x28, 0x20, 0x88, 0xaa, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x8a, 0xaa, 0x00, 0xa0, 0xaa, 0xaa, 0xaa, 0xab, 0x00, 0xfc, 0xaa, 0xaa, 0x02, 0x00, 0xc0, 0xab, 0x03, 0xf0, 0xaa, 0xaa, 0xff, 0xff, 0xff, 0xaa, 0xea, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x4a, 0x55, 0xa5, 0xaa, 0x96, 0x00, 0x58, 0x55, 0x55, 0x01, 0x00, 0x80, 0x55, 0x01, 0x60, 0x55, 0x55, 0xa5, 0xaa, 0x56, 0x55, 0x55, 0x55, 0x6a, 0x05, 0x80, 0x55, 0x55, 0x15, 0x00, 0x56, 0xaa, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x5a, 0xa5, 0xaa, 0x56, 0x55, 0x55, 0x55, 0x6a, 0xa5, 0xaa, 0xaa, 0x55, 0x55, 0xa5, 0xa5, 0xaa, 0xaa, 0xaa, 0xaa, 0x5a, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x05, 0x00, 0x14, 0x00, 0x50, 0x55, 0x55, 0x01, 0x00, 0x00, 0x55, 0x01, 0x40, 0x55, 0x55, 0x05, 0x00, 0x54, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x55, 0x55, 0x15, 0x00, 0x54, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x54, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x54, 0x05, 0x00, 0x54, 0x00, 0x50, 0x55, 0x55, 0x01, 0x00, 0x00, 0x55, 0x01, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0x00, 0x0f, 0x00, 0x00, 0x30, 0x0c, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0x0f, 0xfc, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xfc, 0x00, 0xf0, 0xff, 0xff, 0x03, 0x00, 0x00, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0x5f, 0x55, 0x55, 0x55, 0x55, 0x5f, 0x35, 0x0c, 0x14, 0x10, 0xf4, 0x55, 0xff, 0xff, 0x57, 0x55, 0x55, 0x55, 0xf5, 0x57, 0xff, 0xff, 0x4f, 0x55, 0x55, 0x7f, 0x00, 0xfc, 0xff, 0xff, 0x01, 0x00, 0xc0, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x50, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x14, 0x10, 0x04, 0x55, 0x00, 0x00, 0x54, 0x55, 0x55, 0x55, 0x05, 0x54, 0x00, 0x00, 0x00, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x04, 0x14, 0x10, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x05, 0x00, 0x54, 0x55, 0x41, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0x00, 0xa0, 0xaa, 0x82, 0x00, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x80, 0xaa, 0x0a, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xaa, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0x80, 0x0a, 0x00, 0x00, 0xaa, 0xaa, 0x0a, 0x0a, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x6a, 0xaa, 0x26, 0x08, 0x28, 0x20, 0xa4, 0x6a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa6, 0x6a, 0xaa, 0xaa, 0xaa, 0x4a, 0x55, 0xea, 0x00, 0xa8, 0xaa, 0xfe, 0x03, 0x00, 0xc0, 0xea, 0x03, 0xb0, 0xaa, 0xfa, 0xff, 0xff, 0xbf, 0xaa, 0xfa, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x05, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x80, 0xaa, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x0a, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0x00, 0xfc, 0xab, 0xaa, 0x03, 0x00, 0xc0, 0xab, 0x03, 0xf0, 0xaa, 0xea, 0xff, 0xff, 0xff, 0xaa, 0xfa, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xfe, 0xff, 0xaa, 0x2f, 0x08, 0x28, 0x30, 0xac, 0xfa, 0xaa, 0xaa, 0xaa, 0xaa, 0xff, 0xff, 0xaf, 0xfe, 0xaa, 0xaa, 0xfa, 0xff, 0xff, 0xf2, 0x00, 0xf8, 0xff, 0xff, 0x03, 0x00, 0xc0, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xbf, 0xaa, 0xaa, 0xaa, 0xaa, 0xaf, 0x3a, 0x0c, 0x28, 0x20, 0xf8, 0xaa, 0xff, 0xff, 0xaf, 0xaa, 0xaa, 0xaa, 0xfa, 0xab, 0xff, 0xff, 0xaf, 0xaa, 0xaa, 0x8f, 0x00, 0xfc, 0xff, 0xff, 0x03, 0x00, 0xc0, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaf, 0xaa, 0xaa, 0x2e, 0x00, 0xfc, 0xff, 0xff, 0x03, 0x00, 0xc0, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x01, 0x00, 0x00, 0x00, 0x70, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x00, 0xc0, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xfa, 0xaa, 0xaa, 0xfa, 0x00, 0xf0, 0xff, 0xff, 0x03, 0x00, 0xc0, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x04, 0x14, 0x10, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xf5, 0x55, 0xff, 0x5f, 0x55, 0x55, 0x55, 0x57, 0x00, 0x4c, 0x55, 0x55, 0x01, 0x00, 0xc0, 0x57, 0x01, 0xf0, 0x55, 0x55, 0xf5, 0xff, 0xff, 0x55, 0x55, 0xf5, 0xff, 0x05, 0xc0, 0xff, 0xff, 0x17, 0x00, 0x5f, 0xff, 0xff, 0xff, 0x57, 0x55, 0x55, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0xf5, 0xff, 0xff, 0xff, 0x55, 0xf5, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55 },
+    { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x04, 0x14, 0x10, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x00, 0x50, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x55, 0x55, 0x01, 0x00, 0x00, 0x54, 0x01, 0x00, 0x55, 0x55, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x14, 0x00, 0x50, 0x00, 0x00, 0x00, 0x54, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55 },
+    { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x04, 0x14, 0x10, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x50, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x54, 0x55, 0x01, 0x00, 0x00, 0x54, 0x01, 0x00, 0x55, 0x55, 0x05, 0x00, 0x00, 0x55, 0x55, 0x15, 0x00, 0x05, 0x00, 0x00, 0x00, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x40, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x55 },
+    { 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x6a, 0x25, 0x08, 0x18, 0x10, 0xa4, 0x56, 0xaa, 0xaa, 0xaa, 0x5a, 0x55, 0x55, 0xa5, 0x56, 0xaa, 0xaa, 0x5a, 0x55, 0x55, 0x58, 0x00, 0x00, 0x50, 0x55, 0x01, 0x00, 0x00, 0x54, 0x01, 0x00, 0x55, 0x55, 0x05, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x40, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x00, 0x50, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55 },
+    { 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x10, 0x10, 0x04, 0x54, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x05, 0x54, 0x00, 0x00, 0x50, 0x55, 0x55, 0x50, 0x00, 0x00, 0x40, 0x55, 0x01, 0x00, 0x00, 0x5c, 0x01, 0x00, 0x7f, 0x55, 0x05, 0x00, 0x00, 0x7f, 0x55, 0x55, 0x01, 0x05, 0x00, 0x00, 0x50, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x50, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05, 0x05, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x10, 0x10, 0x04, 0x54, 0x00, 0x00, 0x00, 0x54, 0x55, 0x55, 0x05, 0x54, 0x00, 0x00, 0x50, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x55, 0x01, 0x00, 0x00, 0x70, 0x01, 0x00, 0xc0, 0x5f, 0x05, 0x00, 0x00, 0xc0, 0x5f, 0x55, 0x05, 0x05, 0x00, 0x00, 0x54, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x54, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05, 0x05, 0x00, 0x00, 0x40, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x80, 0x0a, 0x00, 0x20, 0x20, 0x08, 0xa8, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x0a, 0xa8, 0x00, 0x00, 0xa0, 0x5a, 0x55, 0x60, 0x00, 0x00, 0x00, 0x54, 0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x50, 0x15, 0x00, 0x00, 0x00, 0x50, 0x55, 0x05, 0x05, 0x00, 0x00, 0x55, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05, 0x05, 0x00, 0x00, 0x50, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x40, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x50, 0x55, 0x00, 0x00, 0x00, 0x50, 0x55, 0x05, 0x05, 0x00, 0x40, 0x55, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x55, 0x55, 0x55, 0x45, 0x05, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x50, 0x55, 0x40, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x50, 0x55, 0x01, 0x00, 0x00, 0x50, 0x55, 0x05, 0x05, 0x00, 0x50, 0x55, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x50, 0x05, 0x40, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x55, 0x55, 0x55, 0x45, 0x05, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff, 0x00, 0x0f, 0x00, 0x00, 0x30, 0x0c, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0x00, 0xf0, 0xff, 0x0f, 0x0f, 0x00, 0xfc, 0xff, 0x3f, 0x00, 0xf0, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0x00, 0xff, 0xff, 0xff, 0xcf, 0x0f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xea, 0xaf, 0xaa, 0xaa, 0xbf, 0x00, 0xfc, 0xff, 0xff, 0x00, 0x00, 0xc0, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x01, 0x00, 0x00, 0x50, 0x55, 0x15, 0x00, 0x5c, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x01, 0x00, 0x00, 0x40, 0x55, 0x15, 0x00, 0x70, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x01, 0x00, 0x00, 0x00, 0x55, 0x15, 0x00, 0xc0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x01, 0x00, 0x00, 0x00, 0x54, 0x15, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x01, 0x00, 0x00, 0x00, 0x50, 0x15, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x01, 0x00, 0x00, 0x00, 0x40, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x01, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x01, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xfa, 0xfb, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xff, 0x03, 0x00, 0x00, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0xab, 0xaa, 0xaa, 0xaa, 0xaf, 0x3a, 0x0c, 0x28, 0x20, 0xf8, 0xaa, 0xff, 0xaf, 0xaa, 0xaa, 0xaa, 0xaa, 0xfa, 0xaa, 0xff, 0xaf, 0xaa, 0xaa, 0xaa, 0xab, 0x00, 0xac, 0xaa, 0xaa, 0x02, 0x00, 0xc0, 0xa8, 0x02, 0xf0, 0xaa, 0xaa, 0xfa, 0xff, 0xff, 0xaa, 0xaa, 0xfe, 0xff, 0x0a, 0xc0, 0xff, 0xff, 0x2f, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x6a, 0x25, 0x08, 0x18, 0x10, 0xa4, 0x56, 0xaa, 0xaa, 0xaa, 0x56, 0x55, 0x55, 0xa5, 0x56, 0xaa, 0xaa, 0x5a, 0x55, 0x55, 0x5a, 0x00, 0xa8, 0x6a, 0x55, 0x01, 0x00, 0x80, 0x52, 0x01, 0xa0, 0x7f, 0x55, 0xa5, 0xaa, 0xaa, 0x7f, 0x55, 0x55, 0xa5, 0x05, 0x80, 0xaa, 0x56, 0x15, 0x00, 0x5a, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x6a, 0xa5, 0xaa, 0xaa, 0x56, 0x55, 0x55, 0x6a, 0xa5, 0xaa, 0xaa, 0x55, 0x55, 0xa5, 0xa5, 0xaa, 0xaa, 0x6a, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x80, 0x0a, 0x00, 0x20, 0x20, 0x08, 0xa8, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0x0a, 0xa8, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0xa0, 0x00, 0x00, 0x80, 0xaa, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0xc0, 0xaf, 0x0a, 0x00, 0x00, 0xc0, 0xaf, 0xaa, 0x0a, 0x0a, 0x00, 0x00, 0xa8, 0x2a, 0x00, 0xa0, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x80, 0x0a, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0x80, 0x0a, 0x00, 0x00, 0xaa, 0xaa, 0x0a, 0x0a, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0xaa },
+    { 0xaa, 0xaa, 0xaa, 0xfa, 0xff, 0xff, 0xaa, 0x2f, 0x08, 0x28, 0x30, 0xac, 0xfa, 0xaa, 0xaa, 0xaa, 0xaa, 0xea, 0xff, 0xaf, 0xfa, 0xaa, 0xaa, 0xaa, 0xfa, 0xff, 0xea, 0x00, 0xa8, 0xaa, 0xaa, 0x03, 0x00, 0x80, 0x2a, 0x03, 0xa0, 0xaa, 0xfa, 0xff, 0xbf, 0xaa, 0xaa, 0xfa, 0xff, 0xaf, 0x0f, 0x80, 0xff, 0xff, 0x3f, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xff, 0xff, 0xbf, 0xaa, 0xaa, 0xbf, 0x00, 0xfc, 0xff, 0xff, 0x02, 0x00, 0xc0, 0xff, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x01, 0x00, 0x00, 0x58, 0x55, 0x15, 0x00, 0x50, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x01, 0x00, 0x00, 0x60, 0x55, 0x15, 0x00, 0x40, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x01, 0x00, 0x00, 0x80, 0x55, 0x15, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x01, 0x00, 0x00, 0x00, 0x56, 0x15, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x01, 0x00, 0x00, 0x00, 0x58, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xfa, 0xaa, 0xaa, 0xfe, 0xff, 0xff, 0xfe, 0x00, 0xf8, 0xff, 0xff, 0x03, 0x00, 0x80, 0xff, 0x03, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0xaf, 0xaa, 0xaa, 0xaa, 0xaf, 0x3a, 0x0c, 0x28, 0x20, 0xf8, 0xaa, 0xff, 0xbf, 0xaa, 0xaa, 0xaa, 0xaa, 0xfa, 0xaa, 0xff, 0xaf, 0xaa, 0xaa, 0xaa, 0xab, 0x00, 0xac, 0xaa, 0xaa, 0x02, 0x00, 0xc0, 0xaa, 0x02, 0x30, 0xaa, 0xaa, 0xfa, 0xff, 0xff, 0xaa, 0xaa, 0xff, 0xff, 0x0b, 0xc0, 0xff, 0xff, 0x2f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x04, 0x14, 0x10, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x54, 0x55, 0x55, 0x55, 0x55, 0x57, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x04, 0x14, 0x10, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x50, 0x55, 0x55, 0x55, 0x55, 0x5c, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x6a, 0x25, 0x08, 0x18, 0x10, 0xa4, 0x56, 0xaa, 0xaa, 0xaa, 0x56, 0x55, 0x55, 0xa5, 0x56, 0xaa, 0xaa, 0x5a, 0x55, 0x55, 0x5a, 0x00, 0xa8, 0x6a, 0x55, 0x01, 0x00, 0x80, 0x5a, 0x01, 0xa0, 0x40, 0x55, 0xa5, 0xaa, 0xaa, 0x70, 0x55, 0x55, 0xa5, 0x05, 0x80, 0xaa, 0x56, 0x15, 0x00, 0x5a, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x6a, 0xa5, 0xaa, 0xaa, 0x56, 0x55, 0x55, 0x6a, 0xa5, 0xaa, 0xaa, 0x55, 0x55, 0xa5, 0xa5, 0xaa, 0xaa, 0x6a, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x80, 0x0a, 0x00, 0x20, 0x20, 0x08, 0xa8, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0x0a, 0xa8, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0xa0, 0x00, 0x00, 0x80, 0xaa, 0x02, 0x00, 0x00, 0xa0, 0x02, 0x00, 0x00, 0xa5, 0x0a, 0x00, 0x00, 0xc0, 0xa5, 0xaa, 0x0a, 0x0a, 0x00, 0x00, 0xa8, 0x2a, 0x00, 0xa0, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x80, 0x0a, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0x80, 0x0a, 0x00, 0x00, 0xaa, 0xaa, 0x0a, 0x0a, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0xaa },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x5a, 0x25, 0x08, 0x14, 0x10, 0xa4, 0x55, 0xaa, 0xaa, 0x6a, 0x55, 0x55, 0x55, 0xa5, 0x5a, 0xaa, 0xaa, 0xaa, 0x5a, 0x55, 0x69, 0x00, 0xa4, 0xaa, 0xaa, 0x01, 0x00, 0x40, 0xaa, 0x01, 0x90, 0xaa, 0x4a, 0x55, 0x55, 0xa9, 0xaa, 0x7a, 0x55, 0xd5, 0x07, 0x40, 0xff, 0xff, 0x1f, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x5f, 0x55, 0xff, 0xf5, 0xff, 0xff, 0xff, 0x57, 0x55, 0x7f, 0xf5, 0xff, 0xff, 0x55, 0x55, 0xf5, 0xf5, 0x57, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x14, 0x10, 0x04, 0x55, 0x00, 0x00, 0x40, 0x55, 0x55, 0x55, 0x05, 0x50, 0x00, 0x00, 0x00, 0x50, 0x55, 0x41, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x01, 0x10, 0x00, 0x00, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x15, 0x04, 0x40, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x54, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05, 0x05, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x14, 0x10, 0x04, 0x55, 0x00, 0x00, 0x50, 0x55, 0x55, 0x55, 0x05, 0x54, 0x55, 0x05, 0x00, 0x50, 0x55, 0x41, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x01, 0x10, 0x00, 0x00, 0x54, 0x55, 0x05, 0x00, 0x40, 0x55, 0x15, 0x04, 0x40, 0x00, 0x00, 0x10, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x45, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0xa0, 0x0a, 0x00, 0x28, 0x20, 0x08, 0xaa, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0xaa, 0xfa, 0xa8, 0xff, 0x0f, 0x00, 0xa8, 0xaa, 0x83, 0x00, 0x0c, 0x00, 0x00, 0x02, 0x00, 0xc0, 0x00, 0x02, 0x30, 0x00, 0x00, 0xf0, 0xff, 0x3f, 0x00, 0xc0, 0xff, 0x3f, 0x0c, 0xc0, 0x00, 0x00, 0x30, 0x00, 0xc3, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x00, 0xc0, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x15, 0x10, 0x04, 0x04, 0x00, 0x50, 0x01, 0x55, 0x55, 0x55, 0x01, 0x00, 0x00, 0x50, 0x01, 0x55, 0x55, 0x05, 0x00, 0x00, 0x05, 0x00, 0x54, 0x15, 0x00, 0x00, 0x00, 0x40, 0x05, 0x00, 0x50, 0x15, 0x00, 0x40, 0x55, 0x55, 0x15, 0x00, 0x00, 0x50, 0x00, 0x40, 0x55, 0x05, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x15, 0x50, 0x55, 0x55, 0x01, 0x00, 0x00, 0x15, 0x50, 0x55, 0x55, 0x00, 0x00, 0x50, 0x50, 0x55, 0x55, 0x15, 0x00, 0x00, 0x00 },
+    { 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x15, 0x10, 0x04, 0x04, 0x00, 0x50, 0x01, 0x55, 0x55, 0x55, 0x05, 0x00, 0x00, 0x50, 0x01, 0x55, 0x55, 0x05, 0x00, 0x00, 0x05, 0x00, 0x54, 0x55, 0x00, 0x00, 0x00, 0x40, 0x15, 0x00, 0x50, 0x55, 0x05, 0x00, 0x55, 0x55, 0x55, 0x05, 0x00, 0x50, 0x00, 0x40, 0x55, 0x15, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x15, 0x50, 0x55, 0x55, 0x05, 0x00, 0x00, 0x15, 0x50, 0x55, 0x55, 0x00, 0x00, 0x50, 0x50, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00 },
+    { 0x55, 0x55, 0x55, 0x01, 0x00, 0x00, 0x55, 0x10, 0x04, 0x14, 0x00, 0x50, 0x05, 0x55, 0x55, 0x55, 0x15, 0x00, 0x00, 0x50, 0x01, 0x55, 0x55, 0x55, 0x01, 0x00, 0x15, 0x00, 0x54, 0x55, 0x01, 0x00, 0x00, 0x40, 0x15, 0x00, 0x50, 0x55, 0x05, 0x00, 0x54, 0x55, 0x55, 0x05, 0x00, 0x50, 0x00, 0x40, 0x55, 0x55, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x15, 0x50, 0x55, 0x55, 0x15, 0x00, 0x00, 0x15, 0x50, 0x55, 0x55, 0x00, 0x00, 0x50, 0x50, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00 },
+    { 0x55, 0x55, 0x55, 0x05, 0x00, 0x00, 0x55, 0x10, 0x04, 0x14, 0x00, 0x50, 0x05, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x50, 0x01, 0x55, 0x55, 0x55, 0x05, 0x00, 0x15, 0x00, 0x54, 0x55, 0x05, 0x00, 0x00, 0x40, 0x15, 0x00, 0x50, 0x55, 0x05, 0x00, 0x50, 0x55, 0x55, 0x05, 0x00, 0x50, 0x00, 0x40, 0x55, 0x55, 0x01, 0x00, 0x05, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x55, 0x50, 0x55, 0x55, 0x55, 0x00, 0x00, 0x15, 0x50, 0x55, 0x55, 0x00, 0x00, 0x50, 0x51, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00 },
+    { 0x55, 0x55, 0x55, 0x15, 0x00, 0x00, 0x55, 0x10, 0x04, 0x14, 0x00, 0x50, 0x05, 0x55, 0x55, 0x55, 0x55, 0x01, 0x00, 0x50, 0x05, 0x55, 0x55, 0x55, 0x05, 0x00, 0x15, 0x00, 0x54, 0x55, 0x15, 0x00, 0x00, 0x40, 0x15, 0x00, 0x50, 0x55, 0x05, 0x00, 0x40, 0x55, 0x55, 0x05, 0x00, 0x50, 0x00, 0x40, 0x55, 0x55, 0x05, 0x00, 0x15, 0x55, 0x55, 0x55, 0x01, 0x00, 0x00, 0x55, 0x50, 0x55, 0x55, 0x55, 0x01, 0x00, 0x15, 0x50, 0x55, 0x55, 0x01, 0x00, 0x50, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00 },
+    { 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x55, 0x10, 0x04, 0x14, 0x00, 0x50, 0x05, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x50, 0x05, 0x55, 0x55, 0x55, 0x05, 0x00, 0x15, 0x00, 0x54, 0x55, 0x55, 0x00, 0x00, 0x40, 0x15, 0x00, 0x50, 0x55, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05, 0x00, 0x50, 0x01, 0x40, 0x55, 0x55, 0x05, 0x00, 0x15, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x55, 0x50, 0x55, 0x55, 0x55, 0x05, 0x00, 0x55, 0x50, 0x55, 0x55, 0x55, 0x00, 0x50, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01 },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0x02, 0x00, 0xaa, 0x20, 0x08, 0x28, 0x00, 0xa0, 0x0a, 0xaa, 0xaa, 0xaa, 0xaa, 0x16, 0x00, 0xa0, 0x06, 0xaa, 0x6a, 0x55, 0x05, 0x00, 0x16, 0x00, 0x58, 0x55, 0x55, 0x00, 0x00, 0x80, 0x55, 0x00, 0x60, 0x55, 0x05, 0x00, 0x00, 0x54, 0x55, 0x15, 0x00, 0x70, 0x01, 0xc0, 0x55, 0x55, 0x05, 0x00, 0x17, 0xff, 0xff, 0x55, 0x55, 0x01, 0x00, 0x5f, 0xf0, 0xff, 0x7f, 0x55, 0x15, 0x00, 0x7f, 0xf0, 0xff, 0xff, 0x57, 0x00, 0xf0, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x04, 0x00, 0x40, 0x55, 0x05, 0x00, 0x14, 0x00, 0x50, 0x55, 0x55, 0x00, 0x00, 0x00, 0x55, 0x00, 0x40, 0x55, 0x15, 0x00, 0x00, 0x50, 0x55, 0x15, 0x00, 0x40, 0x01, 0x00, 0x55, 0x55, 0x05, 0x00, 0x14, 0x00, 0x00, 0x55, 0x55, 0x05, 0x00, 0x50, 0x00, 0x00, 0x40, 0x55, 0x55, 0x00, 0x40, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x00, 0x05, 0x00, 0x00, 0x10, 0x04, 0x50, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x05, 0x04, 0x00, 0x50, 0x55, 0x05, 0x00, 0x14, 0x00, 0x50, 0x55, 0x55, 0x00, 0x00, 0x00, 0x55, 0x00, 0x40, 0x55, 0x55, 0x00, 0x00, 0x40, 0x55, 0x15, 0x00, 0x40, 0x01, 0x00, 0x55, 0x55, 0x05, 0x00, 0x14, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x50, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50 },
+    { 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x0a, 0x00, 0x00, 0x20, 0x08, 0xa0, 0x00, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0x0a, 0xaa, 0x00, 0xa0, 0xaa, 0x0a, 0x00, 0x28, 0x00, 0xa0, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x80, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0xaa, 0x3a, 0x00, 0xc0, 0x03, 0x00, 0xff, 0xff, 0x0f, 0x00, 0xfc, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc },
+    { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x04, 0x14, 0x10, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x56, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x04, 0x14, 0x10, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x58, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x6a, 0x25, 0x08, 0x18, 0x10, 0xa4, 0x56, 0xaa, 0xaa, 0xaa, 0x56, 0x55, 0x55, 0xa5, 0x56, 0xaa, 0xaa, 0x5a, 0x55, 0x55, 0x5a, 0x00, 0xa8, 0x6a, 0x55, 0x01, 0x00, 0x80, 0x5a, 0x01, 0xa0, 0x60, 0x55, 0xa5, 0xaa, 0xaa, 0x40, 0x55, 0x55, 0xa5, 0x05, 0x80, 0xaa, 0x56, 0x15, 0x00, 0x5a, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x6a, 0xa5, 0xaa, 0xaa, 0x56, 0x55, 0x55, 0x6a, 0xa5, 0xaa, 0xaa, 0x55, 0x55, 0xa5, 0xa5, 0xaa, 0xaa, 0x6a, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x80, 0x0a, 0x00, 0x20, 0x20, 0x08, 0xa8, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0x0a, 0xa8, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0xa0, 0x00, 0x00, 0x80, 0xaa, 0x02, 0x00, 0x00, 0xa0, 0x02, 0x00, 0x80, 0xa5, 0x0a, 0x00, 0x00, 0x00, 0xa5, 0xaa, 0x0a, 0x0a, 0x00, 0x00, 0xa8, 0x2a, 0x00, 0xa0, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x80, 0x0a, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0x80, 0x0a, 0x00, 0x00, 0xaa, 0xaa, 0x0a, 0x0a, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0xaa },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0x00, 0xac, 0xaa, 0xaa, 0x02, 0x00, 0xc0, 0xaa, 0x02, 0xb0, 0xaa, 0xaa, 0xaa, 0xaa, 0xff, 0xaa, 0x8a, 0xaa, 0xfa, 0x0b, 0xc0, 0xff, 0xff, 0x2f, 0x00, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x55, 0x95, 0xaa, 0xaa, 0xaa, 0xaa, 0xa5, 0x1a, 0x04, 0x28, 0x20, 0x58, 0xaa, 0x55, 0x95, 0xaa, 0xaa, 0xaa, 0xaa, 0x5a, 0xaa, 0x55, 0xa5, 0xaa, 0xaa, 0xaa, 0xa9, 0x00, 0xa4, 0xaa, 0xaa, 0x02, 0x00, 0x40, 0xaa, 0x02, 0x50, 0xaa, 0xaa, 0x5a, 0x55, 0x55, 0xaa, 0x2a, 0x55, 0x55, 0x0e, 0x40, 0xaa, 0xaa, 0x3a, 0x00, 0xe9, 0x55, 0x55, 0xfa, 0xff, 0xff, 0xff, 0xf5, 0x5f, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x5f, 0x55, 0xff, 0xff, 0xff, 0xdf, 0x5f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x55, 0x15, 0x00, 0x00, 0x00, 0x00, 0x05, 0x10, 0x04, 0x00, 0x00, 0x50, 0x00, 0x55, 0x15, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x55, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x50, 0x00, 0x00, 0x50, 0x55, 0x55, 0x00, 0x00, 0x54, 0x55, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x15, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x55, 0x00, 0x00, 0x00, 0x10, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x05, 0x10, 0x04, 0x00, 0x00, 0x50, 0x00, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x55, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x50, 0x00, 0x00, 0x50, 0x55, 0x55, 0x00, 0x00, 0x50, 0x55, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x05, 0x50, 0x55, 0x00, 0x00, 0x00, 0x00, 0x05, 0x50, 0x55, 0x00, 0x00, 0x00, 0x10, 0x50, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x55, 0x55, 0x01, 0x00, 0x00, 0x00, 0x05, 0x10, 0x04, 0x00, 0x00, 0x50, 0x00, 0x55, 0x55, 0x01, 0x00, 0x00, 0x00, 0x50, 0x00, 0x55, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x50, 0x00, 0x00, 0x50, 0x55, 0x55, 0x00, 0x00, 0x40, 0x55, 0x00, 0x40, 0x05, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x15, 0x00, 0x00, 0x00, 0x05, 0x50, 0x55, 0x01, 0x00, 0x00, 0x00, 0x15, 0x50, 0x55, 0x15, 0x00, 0x00, 0x10, 0x50, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x05, 0x10, 0x04, 0x00, 0x00, 0x50, 0x00, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x50, 0x01, 0x55, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x50, 0x00, 0x00, 0x50, 0x55, 0x55, 0x00, 0x00, 0x00, 0x55, 0x00, 0x40, 0x15, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x05, 0x50, 0x55, 0x05, 0x00, 0x00, 0x00, 0x15, 0x50, 0x55, 0x55, 0x00, 0x00, 0x10, 0x50, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x55, 0x55, 0x15, 0x00, 0x00, 0x00, 0x05, 0x10, 0x04, 0x00, 0x00, 0x50, 0x00, 0x55, 0x55, 0x15, 0x00, 0x00, 0x00, 0x50, 0x01, 0x55, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x54, 0x01, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x50, 0x00, 0x00, 0x50, 0x55, 0x55, 0x00, 0x00, 0x00, 0x54, 0x00, 0x40, 0x55, 0x00, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x15, 0x50, 0x55, 0x15, 0x00, 0x00, 0x00, 0x15, 0x50, 0x55, 0x55, 0x00, 0x00, 0x50, 0x50, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x15, 0x10, 0x04, 0x04, 0x00, 0x50, 0x01, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x50, 0x01, 0x55, 0x55, 0x05, 0x00, 0x00, 0x05, 0x00, 0x54, 0x05, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x50, 0x00, 0x00, 0x50, 0x55, 0x55, 0x00, 0x00, 0x00, 0x50, 0x00, 0x40, 0x55, 0x01, 0x00, 0x00, 0x05, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x15, 0x50, 0x55, 0x55, 0x00, 0x00, 0x00, 0x15, 0x50, 0x55, 0x55, 0x00, 0x00, 0x50, 0x50, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00 },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xa8, 0xaa, 0xaa, 0x02, 0x00, 0x80, 0xaa, 0x02, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x8a, 0x0a, 0xc0, 0xaa, 0xaa, 0x2a, 0x00, 0xab, 0xff, 0xff, 0xff, 0xaf, 0xaa, 0xaa, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xaa, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xaa, 0xfa, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xfa, 0xff, 0xea, 0x00, 0xa8, 0xaa, 0xaa, 0x03, 0x00, 0x80, 0xaa, 0x03, 0xa0, 0xaa, 0xfa, 0xaf, 0xaa, 0xaa, 0xaa, 0xba, 0xaa, 0x2a, 0x0b, 0x80, 0xff, 0xff, 0x3f, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xff, 0xaf, 0xaa, 0xaa, 0xaa, 0xab, 0x00, 0xac, 0xaa, 0xaa, 0x02, 0x00, 0xc0, 0xaa, 0x02, 0xf0, 0xaa, 0xaa, 0xaa, 0xea, 0xff, 0xaa, 0xaa, 0xaa, 0xfa, 0x08, 0xc0, 0xff, 0xff, 0x2f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xa8, 0xaa, 0xaa, 0x02, 0x00, 0x80, 0xaa, 0x02, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x02, 0x80, 0xaa, 0xaa, 0x3a, 0x00, 0xfa, 0xaa, 0xaa, 0xfe, 0xff, 0xff, 0xff, 0xfa, 0xaf, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xaf, 0xaa, 0xff, 0xff, 0xff, 0xef, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xa8, 0xaa, 0xaa, 0x02, 0x00, 0x80, 0xaa, 0x02, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0x00, 0xaa, 0xaa, 0x2a, 0x00, 0xaf, 0xff, 0xff, 0xff, 0xbf, 0xaa, 0xaa, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0x6a, 0x55, 0x55, 0xaa, 0x25, 0x08, 0x28, 0x10, 0xa4, 0x5a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0xa5, 0x5a, 0xaa, 0xaa, 0xaa, 0x5a, 0x55, 0x6a, 0x00, 0xa8, 0xaa, 0x6a, 0x01, 0x00, 0x80, 0x6a, 0x01, 0xa0, 0xaa, 0x5a, 0xa5, 0xaa, 0xaa, 0xaa, 0x5a, 0xa9, 0xaa, 0x05, 0x80, 0x54, 0x55, 0x15, 0x00, 0x5f, 0xff, 0xff, 0xff, 0x57, 0x55, 0x55, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0xf5, 0xff, 0xff, 0xff, 0x55, 0xf5, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55 },
+    { 0x00, 0x00, 0x00, 0x40, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x10, 0x04, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x05, 0x50, 0x00, 0x00, 0x00, 0x50, 0x55, 0x40, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x05, 0x00, 0x50, 0x55, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x54, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55 },
+    { 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x10, 0x04, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0x55, 0x05, 0x50, 0x00, 0x00, 0x00, 0x50, 0x55, 0x40, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0x00, 0x50, 0x05, 0x00, 0x05, 0x00, 0x40, 0x55, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x40, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x55 },
+    { 0x00, 0x00, 0x00, 0x54, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x10, 0x04, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x05, 0x50, 0x00, 0x00, 0x00, 0x50, 0x55, 0x40, 0x00, 0x00, 0x00, 0x54, 0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0x00, 0x50, 0x15, 0x00, 0x05, 0x00, 0x00, 0x55, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x00, 0x50, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55 },
+    { 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x10, 0x10, 0x04, 0x54, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x05, 0x54, 0x00, 0x00, 0x50, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x55, 0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0x00, 0x50, 0x55, 0x00, 0x05, 0x00, 0x00, 0x54, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x50, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05, 0x05, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x10, 0x10, 0x04, 0x54, 0x00, 0x00, 0x00, 0x54, 0x55, 0x55, 0x05, 0x54, 0x00, 0x00, 0x50, 0x55, 0x55, 0x50, 0x00, 0x00, 0x40, 0x55, 0x01, 0x00, 0x00, 0x50, 0x01, 0x00, 0x40, 0x55, 0x05, 0x00, 0x00, 0x40, 0x55, 0x55, 0x01, 0x05, 0x00, 0x00, 0x50, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x54, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05, 0x05, 0x00, 0x00, 0x40, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x10, 0x10, 0x04, 0x54, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x05, 0x54, 0x00, 0x00, 0x50, 0x55, 0x55, 0x50, 0x00, 0x00, 0x50, 0x55, 0x01, 0x00, 0x00, 0x54, 0x01, 0x00, 0x55, 0x55, 0x05, 0x00, 0x00, 0x55, 0x55, 0x55, 0x05, 0x05, 0x00, 0x00, 0x40, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05, 0x05, 0x00, 0x00, 0x50, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x40, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x14, 0x10, 0x04, 0x55, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x00, 0x50, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x54, 0x55, 0x01, 0x00, 0x00, 0x54, 0x01, 0x00, 0x55, 0x55, 0x15, 0x00, 0x00, 0x55, 0x55, 0x55, 0x05, 0x05, 0x00, 0x00, 0x00, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x55, 0x55, 0x55, 0x45, 0x05, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x50, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x14, 0x10, 0x04, 0x55, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x00, 0x50, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x55, 0x55, 0x01, 0x00, 0x00, 0x54, 0x01, 0x00, 0x55, 0x55, 0x55, 0x00, 0x00, 0x55, 0x55, 0x55, 0x05, 0x05, 0x00, 0x00, 0x00, 0x14, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x50, 0x05, 0x40, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x55, 0x55, 0x55, 0x45, 0x05, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0xaa, 0xa0, 0x0a, 0x00, 0x28, 0x20, 0x08, 0xaa, 0x00, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0xaa, 0x00, 0xa0, 0xaa, 0xaa, 0xaa, 0xa8, 0x00, 0x80, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0xa8, 0x02, 0x00, 0xaa, 0xaa, 0xaa, 0x02, 0x00, 0xaa, 0xaa, 0xaa, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x30, 0x00, 0xf0, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0x00, 0xff, 0xff, 0xff, 0xcf, 0x0f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xa8, 0xaa, 0xaa, 0x02, 0x00, 0x80, 0xaa, 0x02, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xea, 0x0a, 0x80, 0xff, 0xff, 0x0f, 0x00, 0xfe, 0xaa, 0xea, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x15, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x15, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x15, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x15, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xa8, 0xaa, 0xaa, 0x02, 0x00, 0x80, 0xaa, 0x02, 0xa0, 0xaa, 0xba, 0xaa, 0xaa, 0xaa, 0xaa, 0xba, 0xaa, 0xaa, 0x0b, 0x80, 0xff, 0xff, 0x2f, 0x00, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xaa, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xa8, 0xaa, 0xaa, 0x02, 0x00, 0x80, 0xaa, 0x02, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0xc0, 0xaa, 0xaa, 0x2a, 0x00, 0xa3, 0xff, 0xff, 0xff, 0xaf, 0xaa, 0xaa, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xa8, 0xaa, 0xaa, 0x02, 0x00, 0x80, 0xaa, 0x02, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x0e, 0x80, 0xaa, 0xaa, 0x3a, 0x00, 0xca, 0xaa, 0xaa, 0xfa, 0xff, 0xff, 0xff, 0xfa, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xa8, 0xaa, 0xaa, 0x02, 0x00, 0x80, 0xaa, 0x02, 0xe0, 0xaa, 0xaa, 0xaa, 0xaa, 0xea, 0xaa, 0xaa, 0xaa, 0xea, 0x0b, 0x80, 0xff, 0xff, 0x2f, 0x00, 0x3e, 0xaa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x04, 0x14, 0x10, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x57, 0xf5, 0x57, 0x55, 0x55, 0x55, 0x55, 0x57, 0xf5, 0x7f, 0x55, 0x55, 0x55, 0x75, 0xf5, 0xff, 0x7f, 0x55, 0x55, 0x55, 0x55 },
+    { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x04, 0x14, 0x10, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0x54, 0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0x40, 0x55, 0x55, 0x55, 0x45, 0x05, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55 },
+    { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x04, 0x14, 0x10, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0x54, 0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0x50, 0x55, 0x55, 0x55, 0x45, 0x05, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55 },
+    { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x04, 0x14, 0x10, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0x54, 0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0x54, 0x55, 0x55, 0x55, 0x45, 0x05, 0x00, 0x54, 0x55, 0x55, 0x55, 0x55 },
+    { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x04, 0x14, 0x10, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x00, 0x54, 0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0x54, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x56, 0xaa, 0xaa, 0xa6, 0xaa, 0x6a, 0x55, 0xa5, 0xaa, 0x96, 0x00, 0x58, 0x55, 0x55, 0x02, 0x00, 0x80, 0x55, 0x02, 0x60, 0x55, 0x55, 0xa9, 0xaa, 0x6a, 0x55, 0x95, 0xaa, 0x6a, 0x09, 0x80, 0x55, 0x55, 0x25, 0x00, 0x56, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55, 0x5c, 0x05, 0xfc, 0x7f, 0x55, 0x55, 0x55, 0x7f, 0xf5, 0xff, 0xff, 0x57, 0x55, 0xf5, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x04, 0x00, 0x40, 0x55, 0x05, 0x00, 0x14, 0x00, 0x50, 0x55, 0x55, 0x00, 0x00, 0x00, 0x55, 0x00, 0x40, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x15, 0x00, 0x40, 0x01, 0x00, 0x55, 0x55, 0x05, 0x00, 0x54, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x40, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x54, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40 },
+    { 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x00, 0x05, 0x00, 0x00, 0x10, 0x04, 0x50, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x05, 0x54, 0x00, 0x50, 0x55, 0x55, 0x55, 0x54, 0x00, 0x50, 0x55, 0x55, 0x01, 0x00, 0x00, 0x55, 0x01, 0x40, 0x55, 0x55, 0x05, 0x00, 0x50, 0x55, 0x15, 0x00, 0x40, 0x01, 0x00, 0x55, 0x55, 0x15, 0x00, 0x54, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x50, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50 },
+    { 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x00, 0x0a, 0x00, 0x00, 0x20, 0x08, 0xa0, 0x00, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0x0a, 0xaa, 0x00, 0xa0, 0xaa, 0xaa, 0xaa, 0xa8, 0x00, 0xa0, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0xaa, 0x02, 0x80, 0xaa, 0xaa, 0x0a, 0x00, 0xa8, 0xaa, 0xaa, 0x00, 0x80, 0x06, 0x00, 0xaa, 0xaa, 0x1a, 0x00, 0x68, 0x00, 0x00, 0x54, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x54, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x50, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x55, 0x55, 0x55, 0x45, 0x05, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00, 0x40, 0x55, 0x55, 0x55, 0x50, 0x05, 0x40, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x55, 0x55, 0x55, 0x45, 0x05, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff, 0x00, 0x0f, 0x00, 0x00, 0x30, 0x0c, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x3c, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0x00, 0xff, 0xff, 0xff, 0xcf, 0x0f, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0x57, 0x55, 0x55, 0x55, 0x5f, 0x35, 0x0c, 0x14, 0x10, 0xf4, 0x55, 0xff, 0x5f, 0x55, 0x55, 0x55, 0x55, 0xf5, 0x55, 0xff, 0x5f, 0x55, 0x55, 0x55, 0x57, 0x00, 0x7c, 0x55, 0x55, 0x01, 0x00, 0xc0, 0x57, 0x01, 0xf0, 0x55, 0x55, 0x55, 0xf5, 0xff, 0x55, 0x55, 0x55, 0xf5, 0x05, 0xc0, 0x57, 0x55, 0x15, 0x00, 0x5f, 0xff, 0xff, 0xff, 0x54, 0x55, 0x55, 0xff, 0xf5, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0xf5, 0xff, 0xff, 0xff, 0x55, 0xf5, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55 },
+    { 0x00, 0x00, 0x54, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x14, 0x10, 0x04, 0x55, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x00, 0x50, 0x55, 0x55, 0x55, 0x54, 0x00, 0x40, 0x55, 0x55, 0x01, 0x00, 0x00, 0x54, 0x01, 0x00, 0x55, 0x55, 0x55, 0x05, 0x00, 0x55, 0x55, 0x55, 0x05, 0x05, 0x00, 0x54, 0x55, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55 },
+    { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x04, 0x14, 0x10, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x05, 0x00, 0x55, 0x55, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x40, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x40, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x55 },
+    { 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x5a, 0x25, 0x08, 0x14, 0x10, 0xa4, 0x55, 0xaa, 0xaa, 0x6a, 0x55, 0x55, 0x55, 0xa5, 0x5a, 0xaa, 0xaa, 0xaa, 0x5a, 0x55, 0x6a, 0x00, 0xa8, 0xaa, 0xaa, 0x01, 0x00, 0x80, 0xaa, 0x01, 0xa0, 0xaa, 0xaa, 0x56, 0x95, 0xaa, 0xaa, 0x6a, 0x55, 0xa5, 0x06, 0x00, 0xaa, 0xaa, 0x1a, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x50, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55 },
+    { 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x14, 0x10, 0x04, 0x55, 0x00, 0x00, 0x40, 0x55, 0x55, 0x55, 0x05, 0x50, 0x00, 0x00, 0x00, 0x50, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x54, 0x15, 0x00, 0x00, 0x40, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x54, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05, 0x05, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x14, 0x10, 0x04, 0x55, 0x00, 0x00, 0x50, 0x55, 0x55, 0x55, 0x05, 0x54, 0x00, 0x00, 0x00, 0x50, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x00, 0x40, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x45, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0x0a, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0xaa, 0x0a, 0x00, 0xa8, 0xaa, 0x82, 0x00, 0x08, 0x00, 0x00, 0x02, 0x00, 0x80, 0x00, 0x02, 0x20, 0x00, 0x80, 0xaa, 0xaa, 0x02, 0x00, 0x80, 0xaa, 0x2a, 0x08, 0x80, 0x00, 0x00, 0x20, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x40, 0x55, 0x00, 0x07, 0x00, 0x00, 0xc0, 0xff, 0x57, 0xc0, 0x0f, 0x00, 0xc0, 0xff, 0xff, 0xcf, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x54, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x04, 0x00, 0x00, 0x00, 0x50, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xfc, 0x0f, 0x0c, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xa8, 0xaa, 0xaa, 0x02, 0x00, 0x80, 0xaa, 0x02, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0x80, 0xaa, 0xaa, 0x2a, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0xfa, 0xab, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0xfa, 0xff, 0xaa, 0xaa, 0xaa, 0xba, 0xfa, 0xff, 0xff, 0xaa, 0xaa, 0xaa, 0xaa },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xa8, 0xaa, 0xaa, 0x02, 0x00, 0x80, 0xaa, 0x02, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0x80, 0xaa, 0xaa, 0x2a, 0x00, 0xea, 0xaa, 0xaa, 0xaa, 0xff, 0xff, 0xff, 0xe2, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xfa, 0xff, 0xff, 0xaa, 0x2f, 0x08, 0x28, 0x30, 0xac, 0xfa, 0xaa, 0xaa, 0xaa, 0xaa, 0xea, 0xff, 0xaf, 0xfa, 0xaa, 0xaa, 0xaa, 0xfa, 0xff, 0xea, 0x00, 0xa8, 0xaa, 0xfa, 0x03, 0x00, 0x80, 0xea, 0x03, 0xa0, 0xaa, 0xfa, 0xaf, 0xaa, 0xaa, 0xaa, 0xfa, 0xbf, 0xaa, 0x0f, 0x80, 0xaa, 0xaa, 0x3f, 0x00, 0xfa, 0xaa, 0xaa, 0xaa, 0xff, 0xff, 0xff, 0xca, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0xaf, 0xaa, 0xaa, 0xaa, 0xaf, 0x3a, 0x0c, 0x28, 0x20, 0xf8, 0xaa, 0xff, 0xbf, 0xaa, 0xaa, 0xaa, 0xaa, 0xfa, 0xaa, 0xff, 0xaf, 0xaa, 0xaa, 0xaa, 0xab, 0x00, 0xfc, 0xaa, 0xaa, 0x02, 0x00, 0xc0, 0xab, 0x02, 0xf0, 0xaa, 0xaa, 0xaa, 0xfe, 0xff, 0xaa, 0xaa, 0xaa, 0xfa, 0x0a, 0xc0, 0xaf, 0xaa, 0x2a, 0x00, 0xaf, 0xff, 0xff, 0xff, 0xaa, 0xaa, 0xaa, 0x3f, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xa8, 0xaa, 0xaa, 0x02, 0x00, 0x80, 0xaa, 0x02, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0x80, 0xaa, 0xaa, 0x2a, 0x00, 0xab, 0xff, 0xff, 0xff, 0xaa, 0xaa, 0xaa, 0xbf, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xa8, 0xaa, 0xaa, 0x02, 0x00, 0x80, 0xaa, 0x02, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0x80, 0xaa, 0xaa, 0x2a, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa2, 0xaa, 0xaa, 0xaa, 0xaa, 0xfe, 0xaa, 0xae, 0xaa, 0xaa, 0xaa, 0xff, 0xaf, 0xae, 0xaa, 0xaa, 0xaa, 0xfa, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xa8, 0xaa, 0xaa, 0x02, 0x00, 0x80, 0xaa, 0x02, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0x80, 0xaa, 0xaa, 0x2a, 0x00, 0x6a, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x6a, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xfc, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xa8, 0xaa, 0x6a, 0x02, 0x00, 0x80, 0x6a, 0x02, 0xa0, 0xaa, 0x5a, 0xa9, 0xaa, 0xaa, 0xaa, 0x9a, 0xaa, 0xaa, 0x05, 0x80, 0xaa, 0xaa, 0x16, 0x00, 0x5a, 0xaa, 0xaa, 0x6a, 0x55, 0x55, 0x55, 0x5a, 0xe5, 0x53, 0x55, 0x55, 0x55, 0x55, 0x5f, 0xf5, 0xff, 0x55, 0x55, 0x55, 0x75, 0xf5, 0xff, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x14, 0x00, 0x50, 0x00, 0x00, 0x40, 0x55, 0x55, 0x55, 0x50, 0x05, 0x40, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x55, 0x55, 0x55, 0x45, 0x05, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x00, 0x05, 0x00, 0x00, 0x10, 0x04, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0x55, 0x05, 0x50, 0x00, 0x00, 0x00, 0x50, 0x55, 0x40, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x15, 0x00, 0x50, 0x00, 0x00, 0x50, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x55, 0x55, 0x55, 0x45, 0x05, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x10, 0x04, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x05, 0x50, 0x00, 0x00, 0x00, 0x50, 0x55, 0x40, 0x00, 0x00, 0x00, 0x54, 0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x05, 0x00, 0x00, 0x40, 0x15, 0x00, 0x50, 0x00, 0x00, 0x54, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x54, 0x55, 0x55, 0x55, 0x70, 0x05, 0x00, 0xff, 0x57, 0x55, 0xc5, 0x07, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x7f },
+    { 0x00, 0x00, 0x00, 0x40, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x10, 0x04, 0x50, 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x05, 0x54, 0x00, 0x40, 0x55, 0x55, 0x55, 0x54, 0x00, 0x50, 0x55, 0x55, 0x01, 0x00, 0x00, 0x55, 0x01, 0x40, 0x55, 0x55, 0x05, 0x00, 0x40, 0x55, 0x55, 0x05, 0x40, 0x05, 0x00, 0x55, 0x55, 0x15, 0x00, 0x54, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x50, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x54, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40 },
+    { 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x10, 0x04, 0x50, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x05, 0x54, 0x00, 0x50, 0x55, 0x55, 0x55, 0x54, 0x00, 0x50, 0x55, 0x55, 0x01, 0x00, 0x00, 0x55, 0x01, 0x40, 0x55, 0x55, 0x05, 0x00, 0x50, 0x55, 0x55, 0x15, 0x40, 0x05, 0x00, 0x55, 0x55, 0x15, 0x00, 0x54, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x40, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50 },
+    { 0x00, 0x00, 0x00, 0x54, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x10, 0x04, 0x50, 0x00, 0x00, 0x00, 0x40, 0x55, 0x55, 0x05, 0x56, 0x00, 0xa0, 0x5a, 0x55, 0x55, 0x58, 0x00, 0xa0, 0xaa, 0x55, 0x01, 0x00, 0x00, 0x6a, 0x01, 0x80, 0xaa, 0x5a, 0x05, 0x00, 0xa8, 0xaa, 0x5a, 0x55, 0x80, 0x05, 0x00, 0xaa, 0x5a, 0x15, 0x00, 0x58, 0x00, 0xa0, 0xaa, 0x55, 0x55, 0x55, 0x60, 0x05, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54 },
+    { 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x10, 0x10, 0x04, 0x54, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x05, 0x54, 0x00, 0x00, 0x50, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x55, 0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0x00, 0x50, 0x55, 0x01, 0x05, 0x00, 0x00, 0x50, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x54, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05, 0x05, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x10, 0x10, 0x04, 0x54, 0x00, 0x00, 0x00, 0x54, 0x55, 0x55, 0x05, 0x54, 0x00, 0x00, 0x50, 0x55, 0x55, 0x50, 0x00, 0x00, 0x40, 0x55, 0x01, 0x00, 0x00, 0x50, 0x01, 0x00, 0x40, 0x55, 0x05, 0x00, 0x00, 0x40, 0x55, 0x55, 0x05, 0x05, 0x00, 0x00, 0x54, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x50, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05, 0x05, 0x00, 0x00, 0x40, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x10, 0x10, 0x04, 0x54, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x05, 0x58, 0x00, 0x00, 0xa0, 0x5a, 0x55, 0x60, 0x00, 0x00, 0xa0, 0xaa, 0x01, 0x00, 0x00, 0xa8, 0x01, 0x00, 0xaa, 0xaa, 0x16, 0x00, 0x00, 0xaa, 0x6a, 0x55, 0x05, 0x06, 0x00, 0x00, 0xaa, 0x1a, 0x00, 0x60, 0x00, 0x00, 0x00, 0xaa, 0x5a, 0x55, 0x80, 0x05, 0x00, 0x00, 0x40, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05, 0x05, 0x00, 0x00, 0x50, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x40, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x14, 0x10, 0x04, 0x55, 0x00, 0x00, 0x40, 0x55, 0x55, 0x55, 0x05, 0x50, 0x00, 0x00, 0x00, 0x50, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x40, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05, 0x05, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x50, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x14, 0x10, 0x04, 0x55, 0x00, 0x00, 0x50, 0x55, 0x55, 0x55, 0x05, 0x54, 0x00, 0x00, 0x00, 0x50, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x55, 0x01, 0x00, 0x00, 0x40, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x54, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x45, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x54, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x14, 0x10, 0x04, 0x55, 0x00, 0x00, 0x54, 0x55, 0x55, 0x55, 0x05, 0x54, 0x00, 0x00, 0x00, 0x54, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x55, 0x05, 0x00, 0x00, 0x40, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x50, 0x55, 0xc0, 0x05, 0x00, 0xc0, 0xff, 0x55, 0xc5, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55 },
+    { 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x14, 0x10, 0x04, 0x55, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x00, 0x50, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x54, 0x55, 0x01, 0x00, 0x00, 0x54, 0x01, 0x00, 0x55, 0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x05, 0x05, 0x00, 0x40, 0x55, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x40, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x40, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55 },
+    { 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x14, 0x10, 0x04, 0x55, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x00, 0x50, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x55, 0x55, 0x01, 0x00, 0x00, 0x54, 0x01, 0x00, 0x55, 0x55, 0x55, 0x55, 0x00, 0x55, 0x55, 0x55, 0x05, 0x05, 0x00, 0x50, 0x55, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x55 },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x88, 0xaa, 0xaa, 0x02, 0x00, 0x80, 0xa8, 0x02, 0x20, 0xaa, 0xaa, 0xaa, 0xaa, 0x02, 0xaa, 0xaa, 0xaa, 0x0a, 0x0a, 0x00, 0xa8, 0xaa, 0x2a, 0x00, 0xa0, 0x00, 0x00, 0x00, 0xa8, 0xaa, 0xaa, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xff, 0x0f, 0x0c, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff },
+    { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x04, 0x14, 0x10, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0xc0, 0x55, 0x55, 0x15, 0x00, 0x5f, 0xff, 0xff, 0xff, 0x55, 0x55, 0x55, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x04, 0x14, 0x10, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x55, 0x55, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xa8, 0xaa, 0xaa, 0x02, 0x00, 0x80, 0xaa, 0x02, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0x80, 0xaa, 0xaa, 0x2a, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x80, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x0c, 0x3c, 0x30, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x03, 0x00, 0xc0, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xaa, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xaf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xa8, 0xaa, 0xaa, 0x02, 0x00, 0x80, 0xaa, 0x02, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0x80, 0xaa, 0xaa, 0x2a, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xfa, 0xab, 0xaa, 0xaa, 0xaa, 0xaa, 0xa3, 0xfa, 0xff, 0xaa, 0xaa, 0xaa, 0xba, 0xfa, 0xff, 0xab, 0xaa, 0xaa, 0xaa, 0xaa },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xa8, 0xaa, 0xaa, 0x02, 0x00, 0x80, 0xaa, 0x02, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0x80, 0xaa, 0xaa, 0x2a, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x8a, 0xaa, 0xaa, 0xff, 0xaf, 0xaa, 0xea, 0xab, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xa8, 0xaa, 0xaa, 0x02, 0x00, 0x80, 0xaa, 0x02, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0x80, 0xaa, 0xaa, 0x2a, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0xaa, 0xaa, 0xfa, 0xff, 0xaa, 0xea, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xa8, 0xaa, 0xaa, 0x02, 0x00, 0x80, 0xaa, 0x02, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0x80, 0xaa, 0xaa, 0x2a, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xfe, 0xaa, 0xac, 0xaa, 0xaa, 0xaa, 0xff, 0xaf, 0xae, 0xaa, 0xaa, 0xaa, 0xaa, 0xfe, 0xff },
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x0c, 0x3c, 0x30, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfc, 0xff, 0xff, 0x03, 0x00, 0xc0, 0xff, 0x03, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xc0, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xaa, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xab, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x04, 0x14, 0x10, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x55, 0x7f, 0x55, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x04, 0x14, 0x10, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x40, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x04, 0x14, 0x10, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x6a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0xa5, 0x56, 0x55, 0x55, 0x55, 0x55, 0x56, 0x05, 0x54, 0x55, 0x50, 0x55, 0x45, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x04, 0x14, 0x10, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0x54, 0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0x50, 0x55, 0x55, 0x55, 0x45, 0x05, 0x00, 0x00, 0x54, 0x55, 0x55, 0x55 },
+    { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x04, 0x14, 0x10, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0x54, 0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0x40, 0x55, 0x55, 0x55, 0x45, 0x05, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55 },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xa8, 0xaa, 0xaa, 0x02, 0x00, 0x80, 0xaa, 0x02, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0x80, 0xaa, 0xaa, 0x2a, 0x00, 0xaa, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0x0a, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xa8, 0x0a, 0x00, 0xaa, 0xaa, 0xaa, 0x8a, 0x0a, 0x00, 0x80, 0xaa, 0xaa, 0xaa, 0xaa },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xa8, 0xaa, 0xaa, 0x02, 0x00, 0x80, 0xaa, 0x02, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0x80, 0xaa, 0xaa, 0x2a, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x54, 0x55, 0xaa, 0x66, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x00, 0x44, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x55, 0x00, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff, 0x00, 0x0f, 0x00, 0x00, 0x30, 0x0c, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0xc0, 0x0f, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x30, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xc0, 0x0f, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0x57, 0x55, 0x55, 0x55, 0x5f, 0x35, 0x0c, 0x14, 0x10, 0xf4, 0x55, 0xff, 0xff, 0x57, 0x55, 0x55, 0x55, 0xf5, 0x55, 0xff, 0x5f, 0x55, 0x55, 0x55, 0x57, 0x00, 0x5c, 0x55, 0x55, 0x01, 0x00, 0xc0, 0x55, 0x01, 0x70, 0x55, 0x55, 0x55, 0xf5, 0x57, 0x55, 0x55, 0x55, 0x75, 0x05, 0xc0, 0x55, 0x55, 0x15, 0x00, 0x57, 0xff, 0x5f, 0x55, 0x55, 0x55, 0x55, 0x5f, 0xf5, 0xff, 0x57, 0x55, 0x55, 0x55, 0x7f, 0xf5, 0xff, 0xff, 0x54, 0x55, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0x00, 0x00, 0x54, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x14, 0x10, 0x04, 0x55, 0x00, 0x00, 0x54, 0x55, 0x55, 0x55, 0x05, 0x55, 0x00, 0x50, 0x55, 0x55, 0x55, 0x54, 0x00, 0x50, 0x55, 0x55, 0x01, 0x00, 0x00, 0x55, 0x01, 0x40, 0x55, 0x55, 0x55, 0x05, 0x54, 0x55, 0x55, 0x55, 0x45, 0x05, 0x00, 0x55, 0x55, 0x15, 0x00, 0x54, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x54, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x50, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x04, 0x14, 0x10, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x05, 0x55, 0x00, 0x40, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xa8, 0xaa, 0xaa, 0x02, 0x00, 0x80, 0xaa, 0x02, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0x80, 0xaa, 0xaa, 0x2a, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x8a, 0xaa, 0x00, 0x00, 0xaa, 0x0a, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80 },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xa8, 0xaa, 0xaa, 0x02, 0x00, 0x80, 0xaa, 0x02, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0x80, 0xaa, 0xaa, 0x2a, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x6a, 0xaa, 0xa6, 0xaa, 0xaa, 0xaa, 0xaa, 0x56, 0xaa, 0xa6, 0xaa, 0xaa, 0xaa, 0x54, 0xa5, 0xa6, 0xaa, 0xaa, 0xaa, 0x6a, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x04, 0x00, 0x00, 0x00, 0x50, 0x05, 0x04, 0x00, 0x00, 0x00, 0x40, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x05, 0x04, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x05, 0x04, 0x00, 0x00, 0x00, 0x54, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x44, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xa8, 0xaa, 0xaa, 0x02, 0x00, 0x80, 0xaa, 0x02, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0x80, 0xaa, 0xaa, 0x2a, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xea, 0xff, 0xaa, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xfa, 0xff, 0xff, 0xaa, 0x2f, 0x08, 0x28, 0x30, 0xac, 0xfa, 0xaa, 0xaa, 0xaa, 0xaa, 0xff, 0xff, 0xaf, 0xfe, 0xaa, 0xaa, 0xaa, 0xfa, 0xff, 0xea, 0x00, 0xa8, 0xaa, 0xaa, 0x03, 0x00, 0x80, 0xaa, 0x03, 0xa0, 0xaa, 0xaa, 0xaf, 0xaa, 0xaa, 0xaa, 0xea, 0xbf, 0xaa, 0x0e, 0x80, 0xaa, 0xaa, 0x3a, 0x00, 0xea, 0xaa, 0xaa, 0xaa, 0xaa, 0xfe, 0xff, 0xaa, 0xaf, 0xaa, 0xaa, 0xaa, 0xff, 0xff, 0xea, 0xbf, 0xaa, 0xaa, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xff, 0xff, 0xaf, 0xaa, 0xaa, 0xaa, 0xaf, 0x3a, 0x0c, 0x28, 0x20, 0xf8, 0xaa, 0xff, 0xff, 0xaf, 0xaa, 0xaa, 0xaa, 0xfa, 0xab, 0xff, 0xaf, 0xaa, 0xaa, 0xaa, 0xab, 0x00, 0xac, 0xaa, 0xaa, 0x02, 0x00, 0xc0, 0xaa, 0x02, 0xb0, 0xaa, 0xaa, 0xaa, 0xfe, 0xaf, 0xaa, 0xaa, 0xaa, 0xba, 0x0a, 0xc0, 0xaa, 0xaa, 0x2a, 0x00, 0xab, 0xff, 0xbf, 0xaa, 0xaa, 0xaa, 0xaa, 0xaf, 0xfa, 0xff, 0xaf, 0xaa, 0xaa, 0xaa, 0xbf, 0xfa, 0xff, 0xff, 0xaa, 0xaa, 0xfe, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xa8, 0xaa, 0xaa, 0x02, 0x00, 0x80, 0xaa, 0x02, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0x80, 0xaa, 0xaa, 0x2a, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xba, 0xaa, 0xff, 0xab, 0xaa, 0xfa, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xa8, 0xaa, 0xaa, 0x02, 0x00, 0x80, 0xaa, 0x02, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x06, 0x80, 0xaa, 0xaa, 0x1a, 0x00, 0x6a, 0xaa, 0xaa, 0xaa, 0xaa, 0x5a, 0x55, 0xaa, 0xa5, 0xaa, 0xaa, 0xaa, 0x56, 0x55, 0x6a, 0xa5, 0xaa, 0x56, 0x55, 0x55, 0x65, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x54, 0x55, 0x40, 0x05, 0x00, 0x54, 0x55, 0x55, 0x45, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x00, 0x05, 0x00, 0x00, 0x10, 0x04, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0x55, 0x05, 0x50, 0x00, 0x00, 0x00, 0x50, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x55, 0x55, 0x40, 0x05, 0x00, 0x55, 0x55, 0x55, 0x45, 0x05, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x10, 0x04, 0x50, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x05, 0x50, 0x00, 0x00, 0x00, 0x50, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x05, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x40, 0x55, 0x55, 0x50, 0x05, 0x00, 0x55, 0x55, 0x55, 0x45, 0x05, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x40, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x10, 0x04, 0x50, 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x05, 0x50, 0x00, 0x00, 0x00, 0x50, 0x55, 0x40, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0x00, 0x50, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x14, 0x00, 0x50, 0x00, 0x00, 0x40, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x55, 0x55, 0x55, 0x45, 0x05, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x10, 0x04, 0x50, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x05, 0x54, 0x00, 0x00, 0x00, 0x50, 0x55, 0x40, 0x00, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0x00, 0x50, 0x15, 0x00, 0x05, 0x00, 0x00, 0x00, 0x15, 0x00, 0x50, 0x00, 0x00, 0x50, 0x55, 0x55, 0x55, 0x50, 0x05, 0x40, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x55, 0x55, 0x55, 0x45, 0x05, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x54, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x10, 0x04, 0x50, 0x00, 0x00, 0x00, 0x40, 0x55, 0x55, 0x05, 0x54, 0x00, 0x00, 0x00, 0x54, 0x55, 0x40, 0x00, 0x00, 0x00, 0x54, 0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0x00, 0x50, 0x55, 0x00, 0x05, 0x00, 0x00, 0x40, 0x15, 0x00, 0x50, 0x00, 0x00, 0x54, 0x55, 0x55, 0x55, 0x50, 0x05, 0x50, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x55, 0x55, 0x55, 0x45, 0x05, 0x00, 0x54, 0x55, 0x55, 0x55, 0x55 },
+    { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x04, 0x14, 0x10, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0x54, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x55, 0x55, 0x55, 0x45, 0x05, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55 },
+    { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x04, 0x14, 0x10, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0x54, 0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0x00, 0x55, 0x55, 0x55, 0x45, 0x05, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55 },
+    { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x04, 0x14, 0x10, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0x54, 0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0x40, 0x55, 0x55, 0x55, 0x45, 0x05, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55 },
+    { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x04, 0x14, 0x10, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x01, 0x00, 0x40, 0x55, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0x54, 0x55, 0x55, 0x55, 0x55, 0x54, 0x05, 0x50, 0x55, 0x55, 0x55, 0x45, 0x05, 0x00, 0x00, 0x54, 0x55, 0x55, 0x55 },
+    { 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x6a, 0x25, 0x08, 0x18, 0x10, 0xa4, 0x56, 0xaa, 0xaa, 0xaa, 0x5a, 0x55, 0x55, 0xa5, 0x56, 0xaa, 0xaa, 0x5a, 0x55, 0x55, 0x5a, 0x00, 0xa8, 0xaa, 0x55, 0x01, 0x00, 0x80, 0x6a, 0x01, 0xa0, 0xaa, 0x5a, 0xa5, 0xaa, 0xaa, 0xaa, 0x5a, 0x55, 0xa9, 0x05, 0x80, 0xaa, 0x5a, 0x15, 0x00, 0x5a, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x6a, 0x05, 0xa8, 0xaa, 0x5a, 0x55, 0x55, 0x68, 0x05, 0xa8, 0xaa, 0x55, 0x55, 0x85, 0x05, 0x00, 0x00, 0x50, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x10, 0x10, 0x04, 0x54, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x05, 0x54, 0x00, 0x00, 0x50, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x55, 0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0x00, 0x50, 0x55, 0x01, 0x05, 0x00, 0x00, 0x50, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x50, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05, 0x05, 0x00, 0x00, 0x40, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x10, 0x10, 0x04, 0x54, 0x00, 0x00, 0x00, 0x54, 0x55, 0x55, 0x05, 0x54, 0x00, 0x00, 0x50, 0x55, 0x55, 0x50, 0x00, 0x00, 0x40, 0x55, 0x01, 0x00, 0x00, 0x50, 0x01, 0x00, 0x40, 0x55, 0x05, 0x00, 0x00, 0x40, 0x55, 0x55, 0x05, 0x05, 0x00, 0x00, 0x54, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x54, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x55, 0x55, 0x05, 0x05, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x80, 0x0a, 0x00, 0x20, 0x20, 0x08, 0xa8, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x0a, 0xa8, 0x00, 0x00, 0xa0, 0xaa, 0xaa, 0xa0, 0x00, 0x00, 0xa0, 0xaa, 0x02, 0x00, 0x00, 0xa8, 0x02, 0x00, 0xaa, 0xaa, 0x2a, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x0a, 0x0a, 0x00, 0x00, 0xaa, 0x2a, 0x00, 0xa0, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0x80, 0x0a, 0x00, 0x00, 0xaa, 0xaa, 0x56, 0x80, 0x06, 0x00, 0x00, 0xaa, 0x6a, 0x05, 0x06, 0x00, 0x00, 0x00, 0x54, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x05, 0x04, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x04, 0x00, 0x00, 0x00, 0x50, 0x05, 0x04, 0x00, 0x00, 0x00, 0x40, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x04, 0x00, 0x00, 0x00, 0x54, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x04, 0x00, 0x00, 0x00, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x54, 0x55 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00, 0x05, 0x00, 0x00, 0x00, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55 },
+    { 0x00, 0x00, 0x40, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x14, 0x10, 0x04, 0x55, 0x00, 0x00, 0x40, 0x55, 0x55, 0x55, 0x05, 0x54, 0x00, 0x40, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x54, 0x55, 0x01, 0x00, 0x00, 0x54, 0x01, 0x00, 0x55, 0x55, 0x55, 0x00, 0x00, 0x55, 0x55, 0x55, 0x05, 0x05, 0x00, 0x40, 0x55, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x40, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x55 },
+    { 0x00, 0x00, 0x50, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x14, 0x10, 0x04, 0x55, 0x00, 0x00, 0x50, 0x55, 0x55, 0x55, 0x05, 0x54, 0x00, 0x50, 0x55, 0x55, 0x55, 0x54, 0x00, 0x00, 0x55, 0x55, 0x01, 0x00, 0x00, 0x54, 0x01, 0x00, 0x55, 0x55, 0x55, 0x01, 0x00, 0x55, 0x55, 0x55, 0x05, 0x05, 0x00, 0x50, 0x55, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x40, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55 },
+    { 0x00, 0x00, 0x54, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x14, 0x10, 0x04, 0x55, 0x00, 0x00, 0x54, 0x55, 0x55, 0x55, 0x05, 0x55, 0x00, 0x50, 0x55, 0x55, 0x55, 0x54, 0x00, 0x40, 0x55, 0x55, 0x01, 0x00, 0x00, 0x54, 0x01, 0x00, 0x55, 0x55, 0x55, 0x05, 0x00, 0x55, 0x55, 0x55, 0x05, 0x05, 0x00, 0x54, 0x55, 0x15, 0x00, 0x50, 0x00, 0x00, 0x00, 0x54, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x50, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54 },
+    { 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x14, 0x10, 0x04, 0x55, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x00, 0x50, 0x55, 0x55, 0x55, 0x54, 0x00, 0x50, 0x55, 0x55, 0x01, 0x00, 0x00, 0x55, 0x01, 0x40, 0x55, 0x55, 0x55, 0x15, 0x40, 0x55, 0x55, 0x55, 0x45, 0x05, 0x00, 0x55, 0x55, 0x15, 0x00, 0x54, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x40, 0x55, 0x55, 0x55, 0x00, 0x05, 0x00, 0x00, 0x00, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50 },
+    { 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x14, 0x10, 0x04, 0x55, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x00, 0x50, 0x55, 0x55, 0x55, 0x54, 0x00, 0x50, 0x55, 0x55, 0x01, 0x00, 0x00, 0x55, 0x01, 0x40, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x55, 0x55, 0x45, 0x05, 0x00, 0x55, 0x55, 0x15, 0x00, 0x54, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x00, 0x50, 0x55, 0x55, 0x55, 0x40, 0x05, 0x00, 0x00, 0x00, 0x55, 0x05, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40 },
+    { 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x2a, 0x08, 0x28, 0x20, 0xa8, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0xa8, 0xaa, 0xaa, 0x02, 0x00, 0x80, 0xaa, 0x02, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x8a, 0x0a, 0x00, 0xaa, 0xaa, 0x2a, 0x00, 0xa8, 0x00, 0xa0, 0xaa, 0xaa, 0xaa, 0xaa, 0xa0, 0x0a, 0x00, 0xa8, 0xaa, 0xaa, 0xaa, 0x80, 0x0a, 0x00, 0x00, 0x80, 0xaa, 0x0a, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+};
+
+const uint8_t g_LevelJunctionCount = 73;
+
+const uint8_t g_LevelCellJunction[LEVEL_CELLS] = {
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 1, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 2, 3, 255, 255, 255, 4, 255, 5, 255,
+    255, 255, 255, 255, 255, 6, 255, 7, 255, 255, 255, 8, 9, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 10, 255, 255,
+    255, 255, 11, 255, 255, 12, 255, 255, 13, 255, 255, 14, 255, 255, 15, 255,
+    255, 16, 255, 255, 255, 255, 17, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 18, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 19, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 20, 21, 22, 23,
+    255, 255, 255, 255, 255, 255, 255, 255, 24, 25, 26, 27, 255, 255, 255, 255,
+    255, 255, 255, 255, 28, 29, 30, 31, 32, 33, 34, 35, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 36, 37, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    38, 39, 40, 41, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    42, 43, 44, 45, 255, 255, 46, 255, 255, 47, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 48, 255, 255, 49, 255, 255, 50, 51, 52, 53,
+    255, 255, 255, 255, 255, 54, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 55, 255, 255, 255,
+    255, 56, 255, 255, 255, 255, 255, 255, 255, 255, 57, 255, 255, 255, 255, 58,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 59, 255, 255, 60, 255, 255, 255, 255, 255, 255,
+    255, 255, 61, 255, 255, 62, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 63, 255,
+    255, 64, 255, 255, 65, 255, 255, 66, 255, 255, 67, 255, 255, 68, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 69, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 70, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 71, 255, 255, 72, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255
+};
+
+const LevelJunction g_LevelJunctions[LEVEL_JUNCTIONS] = {
+    { .Cell = 34, .Next = { 10, 13, 255, 11 }, .Length = { 9, 10, 0, 4 } },
+    { .Cell = 49, .Next = { 14, 17, 255, 16 }, .Length = { 10, 9, 0, 4 } },
+    { .Cell = 87, .Next = { 255, 3, 255, 255 }, .Length = { 0, 1, 0, 0 } },
+    { .Cell = 88, .Next = { 2, 255, 255, 255 }, .Length = { 1, 0, 0, 0 } },
+    { .Cell = 92, .Next = { 255, 5, 255, 255 }, .Length = { 0, 2, 0, 0 } },
+    { .Cell = 94, .Next = { 4, 255, 255, 255 }, .Length = { 2, 0, 0, 0 } },
+    { .Cell = 101, .Next = { 255, 7, 255, 255 }, .Length = { 0, 2, 0, 0 } },
+    { .Cell = 103, .Next = { 6, 255, 255, 255 }, .Length = { 2, 0, 0, 0 } },
+    { .Cell = 107, .Next = { 255, 9, 255, 255 }, .Length = { 0, 1, 0, 0 } },
+    { .Cell = 108, .Next = { 8, 255, 255, 255 }, .Length = { 1, 0, 0, 0 } },
+    { .Cell = 141, .Next = { 255, 11, 0, 18 }, .Length = { 0, 5, 9, 7 } },
+    { .Cell = 146, .Next = { 10, 12, 0, 18 }, .Length = { 5, 3, 4, 2 } },
+    { .Cell = 149, .Next = { 11, 13, 255, 24 }, .Length = { 3, 3, 0, 7 } },
+    { .Cell = 152, .Next = { 12, 14, 0, 255 }, .Length = { 3, 3, 10, 0 } },
+    { .Cell = 155, .Next = { 13, 15, 1, 255 }, .Length = { 3, 3, 10, 0 } },
+    { .Cell = 158, .Next = { 14, 16, 255, 27 }, .Length = { 3, 3, 0, 7 } },
+    { .Cell = 161, .Next = { 15, 17, 1, 19 }, .Length = { 3, 5, 4, 2 } },
+    { .Cell = 166, .Next = { 16, 255, 1, 19 }, .Length = { 5, 0, 9, 7 } },
+    { .Cell = 202, .Next = { 10, 255, 11, 48 }, .Length = { 7, 0, 2, 5 } },
+    { .Cell = 217, .Next = { 255, 17, 16, 47 }, .Length = { 0, 7, 2, 4 } },
+    { .Cell = 252, .Next = { 31, 21, 255, 32 }, .Length = { 1, 1, 0, 1 } },
+    { .Cell = 253, .Next = { 20, 22, 255, 33 }, .Length = { 1, 1, 0, 1 } },
+    { .Cell = 254, .Next = { 21, 23, 255, 34 }, .Length = { 1, 1, 0, 1 } },
+    { .Cell = 255, .Next = { 22, 35, 255, 35 }, .Length = { 1, 3, 0, 1 } },
+    { .Cell = 264, .Next = { 49, 25, 12, 255 }, .Length = { 6, 1, 7, 0 } },
+    { .Cell = 265, .Next = { 24, 26, 255, 36 }, .Length = { 1, 1, 0, 1 } },
+    { .Cell = 266, .Next = { 25, 27, 255, 37 }, .Length = { 1, 1, 0, 1 } },
+    { .Cell = 267, .Next = { 26, 46, 15, 255 }, .Length = { 1, 5, 7, 0 } },
+    { .Cell = 276, .Next = { 38, 29, 255, 38 }, .Length = { 3, 1, 0, 1 } },
+    { .Cell = 277, .Next = { 28, 30, 255, 39 }, .Length = { 1, 1, 0, 1 } },
+    { .Cell = 278, .Next = { 29, 31, 255, 40 }, .Length = { 1, 1, 0, 1 } },
+    { .Cell = 279, .Next = { 30, 20, 255, 41 }, .Length = { 1, 1, 0, 1 } },
+    { .Cell = 280, .Next = { 41, 33, 20, 255 }, .Length = { 1, 1, 1, 0 } },
+    { .Cell = 281, .Next = { 32, 34, 21, 255 }, .Length = { 1, 1, 1, 0 } },
+    { .Cell = 282, .Next = { 33, 35, 22, 255 }, .Length = { 1, 1, 1, 0 } },
+    { .Cell = 283, .Next = { 34, 23, 23, 255 }, .Length = { 1, 3, 1, 0 } },
+    { .Cell = 293, .Next = { 255, 37, 25, 43 }, .Length = { 0, 1, 1, 1 } },
+    { .Cell = 294, .Next = { 36, 255, 26, 44 }, .Length = { 1, 0, 1, 1 } },
+    { .Cell = 304, .Next = { 28, 39, 28, 255 }, .Length = { 3, 1, 1, 0 } },
+    { .Cell = 305, .Next = { 38, 40, 29, 255 }, .Length = { 1, 1, 1, 0 } },
+    { .Cell = 306, .Next = { 39, 41, 30, 255 }, .Length = { 1, 1, 1, 0 } },
+    { .Cell = 307, .Next = { 40, 32, 31, 255 }, .Length = { 1, 1, 1, 0 } },
+    { .Cell = 320, .Next = { 50, 43, 255, 50 }, .Length = { 3, 1, 0, 1 } },
+    { .Cell = 321, .Next = { 42, 44, 36, 51 }, .Length = { 1, 1, 1, 1 } },
+    { .Cell = 322, .Next = { 43, 45, 37, 52 }, .Length = { 1, 1, 1, 1 } },
+    { .Cell = 323, .Next = { 44, 53, 255, 53 }, .Length = { 1, 3, 0, 1 } },
+    { .Cell = 326, .Next = { 255, 47, 27, 57 }, .Length = { 0, 3, 5, 3 } },
+    { .Cell = 329, .Next = { 46, 255, 19, 54 }, .Length = { 3, 0, 4, 1 } },
+    { .Cell = 342, .Next = { 54, 49, 18, 59 }, .Length = { 13, 3, 5, 4 } },
+    { .Cell = 345, .Next = { 48, 255, 24, 56 }, .Length = { 3, 0, 6, 2 } },
+    { .Cell = 348, .Next = { 42, 51, 42, 255 }, .Length = { 3, 1, 1, 0 } },
+    { .Cell = 349, .Next = { 50, 52, 43, 255 }, .Length = { 1, 1, 1, 0 } },
+    { .Cell = 350, .Next = { 51, 53, 44, 255 }, .Length = { 1, 1, 1, 0 } },
+    { .Cell = 351, .Next = { 52, 45, 45, 255 }, .Length = { 1, 3, 1, 0 } },
+    { .Cell = 357, .Next = { 255, 48, 47, 62 }, .Length = { 0, 13, 1, 4 } },
+    { .Cell = 396, .Next = { 58, 255, 255, 255 }, .Length = { 9, 0, 0, 0 } },
+    { .Cell = 401, .Next = { 255, 57, 49, 60 }, .Length = { 0, 9, 2, 2 } },
+    { .Cell = 410, .Next = { 56, 255, 46, 61 }, .Length = { 9, 0, 3, 2 } },
+    { .Cell = 415, .Next = { 255, 55, 255, 255 }, .Length = { 0, 9, 0, 0 } },
+    { .Cell = 454, .Next = { 69, 60, 48, 63 }, .Length = { 11, 3, 4, 2 } },
+    { .Cell = 457, .Next = { 59, 65, 56, 255 }, .Length = { 3, 5, 2, 0 } },
+    { .Cell = 466, .Next = { 66, 62, 57, 255 }, .Length = { 5, 3, 2, 0 } },
+    { .Cell = 469, .Next = { 61, 70, 54, 68 }, .Length = { 3, 11, 4, 2 } },
+    { .Cell = 510, .Next = { 255, 64, 59, 69 }, .Length = { 0, 3, 2, 5 } },
+    { .Cell = 513, .Next = { 63, 65, 255, 71 }, .Length = { 3, 3, 0, 7 } },
+    { .Cell = 516, .Next = { 64, 66, 60, 255 }, .Length = { 3, 3, 5, 0 } },
+    { .Cell = 519, .Next = { 65, 67, 61, 255 }, .Length = { 3, 3, 5, 0 } },
+    { .Cell = 522, .Next = { 66, 68, 255, 72 }, .Length = { 3, 3, 0, 7 } },
+    { .Cell = 525, .Next = { 67, 255, 62, 70 }, .Length = { 3, 0, 2, 5 } },
+    { .Cell = 563, .Next = { 71, 63, 59, 255 }, .Length = { 15, 5, 11, 0 } },
+    { .Cell = 584, .Next = { 68, 72, 62, 255 }, .Length = { 5, 15, 11, 0 } },
+    { .Cell = 628, .Next = { 69, 72, 64, 255 }, .Length = { 15, 3, 7, 0 } },
+    { .Cell = 631, .Next = { 71, 70, 67, 255 }, .Length = { 3, 15, 7, 0 } },
+};
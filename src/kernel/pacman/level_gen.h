@@ -0,0 +1,8 @@
+// !!! THIS FILE IS AUTOGENERATED from levels/classic.txt by build_scripts/level_compiler.c !!!
+#pragma once
+
+#define LEVEL_ROWS              24
+#define LEVEL_COLS              28
+#define LEVEL_WALKABLE          320
+#define LEVEL_JUNCTIONS         73
+#define LEVEL_FILE_CHECKSUM     0x7a00d7ba
@@ -0,0 +1,32 @@
+#include "link_serial.h"
+#include <arch/i686/uart.h>
+
+#define LINK_PORT               UART_COM1
+#define LINK_DIVISOR            1       // 115200 baud
+
+static void LinkSerial_Initialize()
+{
+    i686_UART_Initialize(LINK_PORT, LINK_DIVISOR);
+}
+
+static bool LinkSerial_Send(uint8_t byte)
+{
+    return i686_UART_TryWrite(LINK_PORT, byte);
+}
+
+static bool LinkSerial_Receive(uint8_t* byte)
+{
+    return i686_UART_TryRead(LINK_PORT, byte);
+}
+
+static const LinkDriver g_LinkSerialDriver = {
+    .Name = "COM1",
+    .Initialize = &LinkSerial_Initialize,
+    .Send = &LinkSerial_Send,
+    .Receive = &LinkSerial_Receive,
+};
+
+const LinkDriver* LinkSerial_GetDriver()
+{
+    return &g_LinkSerialDriver;
+}
@@ -0,0 +1,5 @@
+#pragma once
+#include "netplay.h"
+
+// COM1 at 115200 baud, for a serial pipe between two qemu instances
+const LinkDriver* LinkSerial_GetDriver();
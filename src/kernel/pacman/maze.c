@@ -0,0 +1,164 @@
+#include "maze.h"
+
+Maze g_Maze;
+
+const uint8_t g_ExitCount[16] = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 };
+
+const uint8_t g_ExitDirection[16][4] = {
+    { 0, 0, 0, 0 },
+    { 0, 0, 0, 0 },
+    { 1, 0, 0, 0 },
+    { 0, 1, 0, 0 },
+    { 2, 0, 0, 0 },
+    { 0, 2, 0, 0 },
+    { 1, 2, 0, 0 },
+    { 0, 1, 2, 0 },
+    { 3, 0, 0, 0 },
+    { 0, 3, 0, 0 },
+    { 1, 3, 0, 0 },
+    { 0, 1, 3, 0 },
+    { 2, 3, 0, 0 },
+    { 0, 2, 3, 0 },
+    { 1, 2, 3, 0 },
+    { 0, 1, 2, 3 },
+};
+
+// The geometric neighbor, -1 past the top or the bottom edge.
+// The left and the right edges wrap around.
+static int Step(int index, Direction direction)
+{
+    int x = MAZE_X(index);
+    int y = MAZE_Y(index);
+
+    switch (direction) {
+    case left:  x = (x + NUM_COLS - 1) % NUM_COLS; break;
+    case right: x = (x + 1) % NUM_COLS; break;
+    case up:    y--; break;
+    case down:  y++; break;
+    }
+
+    if (y < 0 || y >= NUM_ROWS)
+        return -1;
+    return MAZE_INDEX(x, y);
+}
+
+static bool Passable(int index)
+{
+    return MAZE_TILE(g_Maze.Cells[index]) != TILE_WALL;
+}
+
+static void SetBit(Bitboard* bb, int index, bool value)
+{
+    if (value)
+        Bitboard_Set(bb, index);
+    else
+        Bitboard_Reset(bb, index);
+}
+
+static void Link(int index)
+{
+    uint8_t exits = 0;
+    int x = MAZE_X(index);
+
+    for (int d = left; d <= down; d++) {
+        int next = Step(index, d);
+        if (Passable(index) && next >= 0 && Passable(next)) {
+            exits |= MAZE_EXIT(d);
+            g_Maze.Neighbors[index][d] = next;
+        }
+        else {
+            g_Maze.Neighbors[index][d] = index;
+        }
+    }
+    g_Maze.Cells[index] = MAZE_TILE(g_Maze.Cells[index]) | (exits << 4);
+
+    bool wrapLeft = (exits & MAZE_EXIT(left)) && x == 0;
+    bool wrapRight = (exits & MAZE_EXIT(right)) && x == NUM_COLS - 1;
+    SetBit(&g_Maze.Walkable, index, Passable(index));
+    SetBit(&g_Maze.Exits[left], index, (exits & MAZE_EXIT(left)) && !wrapLeft);
+    SetBit(&g_Maze.Exits[right], index, (exits & MAZE_EXIT(right)) && !wrapRight);
+    SetBit(&g_Maze.Exits[up], index, exits & MAZE_EXIT(up));
+    SetBit(&g_Maze.Exits[down], index, exits & MAZE_EXIT(down));
+    SetBit(&g_Maze.WrapLeft, index, wrapLeft);
+    SetBit(&g_Maze.WrapRight, index, wrapRight);
+}
+
+// Turns the walls of the two rows from y on into paths, in column x
+static void OpenWall(int x, int y)
+{
+    for (int row = y; row <= y + 1 && x < NUM_COLS; row++)
+        if (g_Maze.Cells[MAZE_INDEX(x, row)] == TILE_WALL)
+            g_Maze.Cells[MAZE_INDEX(x, row)] = TILE_PATH;
+}
+
+// Copies of a landscape stacked on each other are walled off from each other
+// by its top and bottom edges. The wall opens between them at the outermost
+// columns with paths on both sides, so the whole maze is one.
+static void OpenSeams(const uint8_t* landscape, int rows, int cols)
+{
+    int first = -1, last = -1;
+
+    for (int x = 0; x < cols && rows > 2; x++) {
+        if (landscape[(rows - 2) * cols + x] != TILE_WALL && landscape[cols + x] != TILE_WALL) {
+            if (first < 0)
+                first = x;
+            last = x;
+        }
+    }
+    if (first < 0)
+        return;
+
+    for (int y = rows - 1; y + 1 < NUM_ROWS; y += rows) {
+        for (int x = 0; x < NUM_COLS; x += cols) {
+            OpenWall(x + first, y);
+            OpenWall(x + last, y);
+        }
+    }
+}
+
+void Maze_Load(const uint8_t* landscape, int rows, int cols)
+{
+    for (int y = 0; y < NUM_ROWS; y++) {
+        for (int x = 0; x < NUM_COLS; x++) {
+            // anything beyond the tiles marks a spawn point on a free cell
+            uint8_t tile = landscape[(y % rows) * cols + x % cols];
+            g_Maze.Cells[MAZE_INDEX(x, y)] = tile <= TILE_DOOR ? tile : TILE_PATH;
+        }
+    }
+    if (rows < NUM_ROWS)
+        OpenSeams(landscape, rows, cols);
+
+    for (int i = 0; i < MAZE_CELLS; i++)
+        Link(i);
+}
+
+void Maze_LoadPrecomputed(const uint8_t* cells, const uint16_t (*neighbors)[4], const Bitboard* bitboards)
+{
+    for (int i = 0; i < MAZE_CELLS; i++) {
+        g_Maze.Cells[i] = cells[i];
+        for (int d = left; d <= down; d++)
+            g_Maze.Neighbors[i][d] = neighbors[i][d];
+    }
+
+    g_Maze.Walkable = bitboards[0];
+    for (int d = left; d <= down; d++)
+        g_Maze.Exits[d] = bitboards[1 + d];
+    g_Maze.WrapLeft = bitboards[5];
+    g_Maze.WrapRight = bitboards[6];
+}
+
+void Maze_SetTile(int index, Tile tile)
+{
+    bool passable = Passable(index);
+    g_Maze.Cells[index] = (g_Maze.Cells[index] & 0xF0) | tile;
+    if (passable == Passable(index))
+        return;
+
+    // a wall appeared or disappeared, the exits around it change
+    Link(index);
+    for (int d = left; d <= down; d++) {
+        int next = Step(index, d);
+        if (next >= 0)
+            Link(next);
+    }
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include "layout.h"
+#include "bitboard.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef enum {
+    TILE_PATH   = 0,
+    TILE_WALL   = 1,
+    TILE_DOT    = 2,
+    TILE_POWER  = 3,
+    TILE_DOOR   = 4,    // the exit of the ghost house
+} Tile;
+
+// A cell is one byte: the tile in the low nibble, the legal exits
+// (one bit per Direction) in the high nibble
+#define MAZE_TILE(cell)         ((cell) & 0x0F)
+#define MAZE_EXITS(cell)        ((cell) >> 4)
+#define MAZE_EXIT(direction)    (1 << (direction))
+
+typedef struct {
+    uint8_t Cells[MAZE_CELLS];
+    // The cell reached by going in each direction. Blocked directions lead
+    // back to the cell itself, so a move never needs a wall check.
+    // Wraps around at the left and right edges (the tunnel).
+    uint16_t Neighbors[MAZE_CELLS][4];
+
+    // The same maze as bitboards, for the bit-parallel searches
+    Bitboard Walkable;
+    Bitboard Exits[4];      // cells with a legal exit in each direction, not counting the tunnel
+    Bitboard WrapLeft;      // cells whose left exit leads to the last column
+    Bitboard WrapRight;     // cells whose right exit leads to the first column
+} Maze;
+
+extern Maze g_Maze;
+
+// The number of exits and the direction of the n-th exit for each exit mask
+extern const uint8_t g_ExitCount[16];
+extern const uint8_t g_ExitDirection[16][4];
+
+// Takes the tiles of a landscape of rows x cols, repeated over the maze
+// if the maze is larger
+void Maze_Load(const uint8_t* landscape, int rows, int cols);
+
+// Takes a maze worked out ahead of time (a level file): the cells, the
+// neighbors, and the Walkable, Exits, WrapLeft and WrapRight bitboards in a row
+void Maze_LoadPrecomputed(const uint8_t* cells, const uint16_t (*neighbors)[4], const Bitboard* bitboards);
+void Maze_SetTile(int index, Tile tile);
+
+static inline Tile Maze_Tile(int index)
+{
+    return MAZE_TILE(g_Maze.Cells[index]);
+}
+
+static inline uint8_t Maze_Exits(int index)
+{
+    return MAZE_EXITS(g_Maze.Cells[index]);
+}
+
+static inline bool Maze_InRect(const MazeRect* rect, int index)
+{
+    int x = MAZE_X(index) - rect->X, y = MAZE_Y(index) - rect->Y;
+    return (unsigned)x < (unsigned)rect->Width && (unsigned)y < (unsigned)rect->Height;
+}
+
+static inline uint16_t Maze_Neighbor(int index, Direction direction)
+{
+    return g_Maze.Neighbors[index][direction];
+}
@@ -0,0 +1,280 @@
+#include "maze_gen.h"
+#include "maze.h"
+#include "level_file.h"
+
+// The left half is carved on a grid of nodes at the odd columns and rows,
+// then mirrored. The two middle columns are left to the crossings.
+#define HALF_COLS               (NUM_COLS / 2)
+#define NODE_COLS               ((HALF_COLS - 1) / 2)
+#define NODE_ROWS               ((NUM_ROWS - 1) / 2)
+#define NODES                   (NODE_COLS * NODE_ROWS)
+#define NODE_X(node)            (1 + 2 * ((node) % NODE_COLS))
+#define NODE_Y(node)            (1 + 2 * ((node) / NODE_COLS))
+
+#define LOOP_PERCENT            12  // corridors carved on top of the spanning tree
+#define CROSSING_PERCENT        30  // node rows with a way across the middle
+#define MIN_CROSSINGS           2
+#define MAX_ATTEMPTS            8
+#define HOUSE_ROW               (NUM_ROWS / 2)
+
+#define AT(x, y)                ((y) * NUM_COLS + (x))
+
+#if NUM_COLS < 16 || NUM_ROWS < 12
+#error "The generator needs a maze of at least 16x12 for the ghost house"
+#endif
+
+// xorshift32, apart from the game's generator so a maze only depends on its seed
+static uint32_t g_State;
+
+static uint32_t Next()
+{
+    g_State ^= g_State << 13;
+    g_State ^= g_State >> 17;
+    g_State ^= g_State << 5;
+    return g_State;
+}
+
+static bool Chance(uint32_t percent)
+{
+    return Next() % 100 < percent;
+}
+
+// Union-find with path halving, over the nodes while carving and over the
+// cells while validating
+static uint16_t g_Parent[MAZE_CELLS];
+
+static int Find(int i)
+{
+    while (g_Parent[i] != i) {
+        g_Parent[i] = g_Parent[g_Parent[i]];
+        i = g_Parent[i];
+    }
+    return i;
+}
+
+static bool Union(int a, int b)
+{
+    a = Find(a);
+    b = Find(b);
+    if (a == b)
+        return false;
+    g_Parent[a < b ? b : a] = a < b ? a : b;
+    return true;
+}
+
+// An edge is a corridor between neighbor nodes, node * 2 to the right, node * 2 + 1 down
+static uint16_t g_Edges[2 * NODES];
+static bool g_Linked[2 * NODES];
+static uint8_t g_Degree[NODES];
+static bool g_Crossing[NODE_ROWS];
+static int g_Tunnel;                // the node row with the tunnel
+
+static int EdgeTarget(int edge)
+{
+    return (edge & 1) ? (edge >> 1) + NODE_COLS : (edge >> 1) + 1;
+}
+
+static void Link(int edge)
+{
+    g_Linked[edge] = true;
+    g_Degree[edge >> 1]++;
+    g_Degree[EdgeTarget(edge)]++;
+}
+
+// The edge leaving the node in the direction, -1 at the edge of the grid
+static int Edge(int node, Direction direction)
+{
+    int col = node % NODE_COLS, row = node / NODE_COLS;
+
+    switch (direction) {
+    case left:  return col > 0 ? (node - 1) * 2 : -1;
+    case right: return col < NODE_COLS - 1 ? node * 2 : -1;
+    case up:    return row > 0 ? (node - NODE_COLS) * 2 + 1 : -1;
+    case down:  return row < NODE_ROWS - 1 ? node * 2 + 1 : -1;
+    }
+    return -1;
+}
+
+// Kruskal's spanning tree in a random order with some of the left over
+// edges as loops, then every node with a single way out gets another one
+static void Carve()
+{
+    int edges = 0, crossings = 0;
+
+    for (int node = 0; node < NODES; node++) {
+        g_Parent[node] = node;
+        g_Degree[node] = 0;
+        for (int d = right; d <= down; d += down - right) {
+            int edge = Edge(node, d);
+            if (edge >= 0)
+                g_Edges[edges++] = edge;
+        }
+    }
+    for (int i = 0; i < 2 * NODES; i++)
+        g_Linked[i] = false;
+
+    for (int i = edges - 1; i > 0; i--) {
+        int j = Next() % (i + 1);
+        uint16_t swap = g_Edges[i];
+        g_Edges[i] = g_Edges[j];
+        g_Edges[j] = swap;
+    }
+    for (int i = 0; i < edges; i++)
+        if (Union(g_Edges[i] >> 1, EdgeTarget(g_Edges[i])) || Chance(LOOP_PERCENT))
+            Link(g_Edges[i]);
+
+    // the ways across the middle and the tunnel count as exits of their nodes
+    for (int row = 0; row < NODE_ROWS; row++) {
+        g_Crossing[row] = Chance(CROSSING_PERCENT);
+        crossings += g_Crossing[row];
+    }
+    while (crossings < MIN_CROSSINGS) {
+        int row = Next() % NODE_ROWS;
+        crossings += !g_Crossing[row];
+        g_Crossing[row] = true;
+    }
+    for (int row = 0; row < NODE_ROWS; row++)
+        g_Degree[row * NODE_COLS + NODE_COLS - 1] += g_Crossing[row];
+    g_Tunnel = Next() % NODE_ROWS;
+    g_Degree[g_Tunnel * NODE_COLS]++;
+
+    // a node with less than two exits has an unlinked neighbor, the grid is at least 2x2
+    for (int node = 0; node < NODES; node++) {
+        while (g_Degree[node] < 2) {
+            int edge = Edge(node, (Direction)(Next() & 3));
+            if (edge >= 0 && !g_Linked[edge])
+                Link(edge);
+        }
+    }
+}
+
+static void Fill(uint8_t* landscape, int x0, int y0, int x1, int y1, uint8_t tile)
+{
+    for (int y = y0; y <= y1; y++)
+        for (int x = x0; x <= x1; x++)
+            landscape[AT(x, y)] = tile;
+}
+
+// The left half from the nodes, mirrored onto the right one
+static void Paint(uint8_t* landscape)
+{
+    int lastX = NODE_X(NODE_COLS - 1);
+
+    Fill(landscape, 0, 0, NUM_COLS - 1, NUM_ROWS - 1, TILE_WALL);
+    for (int node = 0; node < NODES; node++)
+        landscape[AT(NODE_X(node), NODE_Y(node))] = TILE_PATH;
+    for (int edge = 0; edge < 2 * NODES; edge++)
+        if (g_Linked[edge])
+            landscape[AT(NODE_X(edge >> 1) + !(edge & 1), NODE_Y(edge >> 1) + (edge & 1))] = TILE_PATH;
+    for (int row = 0; row < NODE_ROWS; row++)
+        if (g_Crossing[row])
+            Fill(landscape, lastX + 1, 1 + 2 * row, NUM_COLS - 2 - lastX, 1 + 2 * row, TILE_PATH);
+    landscape[AT(0, 1 + 2 * g_Tunnel)] = TILE_PATH;
+
+    for (int y = 0; y < NUM_ROWS; y++)
+        for (int x = 0; x < HALF_COLS; x++)
+            landscape[AT(NUM_COLS - 1 - x, y)] = landscape[AT(x, y)];
+}
+
+// The ghost house in the middle, a corridor all around it, the door on top
+// and pacman right below. The corridor meets every path it cuts through.
+static void PlaceHouse(uint8_t* landscape)
+{
+    int left = NUM_COLS / 2 - 1, right = NUM_COLS - 1 - left, y = HOUSE_ROW;
+
+    Fill(landscape, left - 4, y - 3, right + 4, y + 3, TILE_PATH);
+    Fill(landscape, left - 3, y - 2, right + 3, y + 2, TILE_WALL);
+    Fill(landscape, left - 2, y - 1, right + 2, y + 1, TILE_PATH);
+    Fill(landscape, left, y - 2, right, y - 2, TILE_DOOR);
+
+    landscape[AT(left, y)] = LEVEL_SPAWN_GHOST;
+    landscape[AT(right, y)] = LEVEL_SPAWN_GHOST + 1;
+    landscape[AT(left - 1, y)] = LEVEL_SPAWN_GHOST + 2;
+    landscape[AT(right + 1, y)] = LEVEL_SPAWN_GHOST + 3;
+    landscape[AT(left, y + 3)] = LEVEL_SPAWN_PACMAN;
+}
+
+// Dots everywhere but around the house and in the tunnel, power pellets in the corners
+static void PlacePellets(uint8_t* landscape)
+{
+    int left = NUM_COLS / 2 - 1, right = NUM_COLS - 1 - left;
+    int lastY = NODE_Y(NODES - 1);
+
+    for (int y = 0; y < NUM_ROWS; y++) {
+        for (int x = 1; x < NUM_COLS - 1; x++) {
+            bool house = x >= left - 4 && x <= right + 4 && y >= HOUSE_ROW - 3 && y <= HOUSE_ROW + 3;
+            if (landscape[AT(x, y)] == TILE_PATH && !house)
+                landscape[AT(x, y)] = TILE_DOT;
+        }
+    }
+    landscape[AT(1, 1)] = TILE_POWER;
+    landscape[AT(NUM_COLS - 2, 1)] = TILE_POWER;
+    landscape[AT(1, lastY)] = TILE_POWER;
+    landscape[AT(NUM_COLS - 2, lastY)] = TILE_POWER;
+}
+
+bool MazeGen_Generate(uint32_t seed, uint8_t* landscape, MazeGenStats* stats)
+{
+    for (uint32_t attempt = 0; attempt < MAX_ATTEMPTS; attempt++) {
+        uint32_t next = seed + attempt * 0x9E3779B9u;
+
+        // spread the seed over the state, xorshift never leaves 0
+        g_State = next * 2654435761u + 0x9E3779B9u;
+        if (g_State == 0)
+            g_State = 1;
+
+        Carve();
+        Paint(landscape);
+        PlaceHouse(landscape);
+        PlacePellets(landscape);
+
+        stats->Seed = next;
+        stats->Attempts = attempt + 1;
+        if (MazeGen_Validate(landscape, stats))
+            return true;
+    }
+    return false;
+}
+
+static bool Walkable(const uint8_t* landscape, int x, int y)
+{
+    return y >= 0 && y < NUM_ROWS && landscape[AT((x + NUM_COLS) % NUM_COLS, y)] != TILE_WALL;
+}
+
+bool MazeGen_Validate(const uint8_t* landscape, MazeGenStats* stats)
+{
+    stats->Walkable = 0;
+    stats->Pellets = 0;
+    stats->Junctions = 0;
+    stats->DeadEnds = 0;
+    stats->Components = 0;
+
+    for (int cell = 0; cell < MAZE_CELLS; cell++)
+        g_Parent[cell] = cell;
+
+    for (int y = 0; y < NUM_ROWS; y++) {
+        for (int x = 0; x < NUM_COLS; x++) {
+            uint8_t tile = landscape[AT(x, y)];
+            if (tile == TILE_WALL)
+                continue;
+
+            int exits = Walkable(landscape, x - 1, y) + Walkable(landscape, x + 1, y)
+                      + Walkable(landscape, x, y - 1) + Walkable(landscape, x, y + 1);
+            stats->Walkable++;
+            stats->Pellets += tile == TILE_DOT || tile == TILE_POWER;
+            stats->DeadEnds += exits == 1;
+            stats->Junctions += exits >= 3;
+
+            // the right and the lower neighbor, the others join from their side
+            if (Walkable(landscape, x + 1, y))
+                Union(AT(x, y), AT((x + 1) % NUM_COLS, y));
+            if (Walkable(landscape, x, y + 1))
+                Union(AT(x, y), AT(x, y + 1));
+        }
+    }
+
+    for (int cell = 0; cell < MAZE_CELLS; cell++)
+        stats->Components += landscape[cell] != TILE_WALL && Find(cell) == cell;
+
+    return stats->Components == 1 && stats->DeadEnds == 0;
+}
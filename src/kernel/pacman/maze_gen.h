@@ -0,0 +1,30 @@
+#pragma once
+#include "layout.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+// Mazes made up at runtime from a seed, for levels without end.
+// A landscape is NUM_ROWS x NUM_COLS bytes in rows, encoded the way
+// levels/classic.txt compiles: the tiles, then the spawn points
+// (LEVEL_SPAWN_GHOST.., LEVEL_SPAWN_PACMAN).
+
+typedef struct {
+    uint32_t Seed;          // the seed of the maze that passed
+    uint32_t Attempts;      // mazes made until one passed the checks
+    uint32_t Walkable;
+    uint32_t Pellets;
+    uint32_t Junctions;     // cells with three or four exits
+    uint32_t DeadEnds;      // cells with a single exit
+    uint32_t Components;    // pieces the walkable cells fall into
+} MazeGenStats;
+
+// A maze mirrored left to right like the arcade's, with a ghost house in
+// the middle, a tunnel, loops and no dead ends, all of it connected. The
+// same seed always makes the same maze. Returns false if no maze passed
+// the checks within a few attempts.
+bool MazeGen_Generate(uint32_t seed, uint8_t* landscape, MazeGenStats* stats);
+
+// One union-find pass over the walkable cells, counting the pieces they fall
+// into, the dead ends and the junctions. The tunnel joins the left and the
+// right edges, the way the engine links them.
+bool MazeGen_Validate(const uint8_t* landscape, MazeGenStats* stats);
@@ -0,0 +1,251 @@
+#include "netplay.h"
+#include <arch/i686/tsc.h>
+#include <debug.h>
+
+#define MODULE                  "NETPLAY"
+#define PACKET_HELLO            0x5A
+#define PACKET_MOVES            0xA5
+#define HELLO_SIZE              6
+#define MOVES_SIZE              7
+#define MOVES_PER_PACKET        3
+#define HELLO_PERIOD            100000  // polls between two hellos while connecting
+#define SEND_QUEUE_SIZE         256     // must be a power of 2
+#define HISTORY_MASK            (NETPLAY_HISTORY - 1)
+
+static const LinkDriver* g_Link;
+static bool g_Pacman;
+static bool g_Started;
+static NetplayStats g_Stats;
+
+// The bytes waiting for the line to take them
+static uint8_t g_SendQueue[SEND_QUEUE_SIZE];
+static uint32_t g_SendHead;
+static uint32_t g_SendTail;
+
+// The packet coming in
+static uint8_t g_Packet[MOVES_SIZE];
+static int g_PacketSize;
+
+static uint32_t g_PeerNonce;
+static bool g_PeerHello;
+
+// Per tick, at tick & HISTORY_MASK: the state before it and both moves
+static GameState g_States[NETPLAY_HISTORY];
+static uint8_t g_LocalMoves[NETPLAY_HISTORY];
+static uint8_t g_PeerMoves[NETPLAY_HISTORY];
+static uint32_t g_Confirmed;        // the peer's moves are known for the ticks before it
+static uint32_t g_RollbackTick;     // the first tick played on a wrong guess
+static bool g_Rollback;
+static bool g_Stalled;              // the next tick waits for the peer
+
+static void Queue(const uint8_t* bytes, int size)
+{
+    uint8_t check = 0;
+
+    // a packet that doesn't fit is dropped whole, the next one carries its moves
+    if (SEND_QUEUE_SIZE - (g_SendHead - g_SendTail) < (uint32_t)size + 1)
+        return;
+
+    for (int i = 0; i < size; i++) {
+        g_SendQueue[g_SendHead++ & (SEND_QUEUE_SIZE - 1)] = bytes[i];
+        check ^= bytes[i];
+    }
+    g_SendQueue[g_SendHead++ & (SEND_QUEUE_SIZE - 1)] = check;
+}
+
+static void Flush()
+{
+    while (g_SendTail != g_SendHead && g_Link->Send(g_SendQueue[g_SendTail & (SEND_QUEUE_SIZE - 1)])) {
+        g_SendTail++;
+        g_Stats.BytesSent++;
+    }
+}
+
+static void SendHello(uint32_t nonce)
+{
+    uint8_t packet[HELLO_SIZE - 1] = { PACKET_HELLO, nonce, nonce >> 8, nonce >> 16, nonce >> 24 };
+    Queue(packet, sizeof(packet));
+}
+
+static void SendMoves(uint32_t tick)
+{
+    uint8_t packet[MOVES_SIZE - 1] = { PACKET_MOVES, tick, tick >> 8 };
+
+    for (int i = 0; i < MOVES_PER_PACKET; i++) {
+        uint32_t past = MOVES_PER_PACKET - 1 - i;
+        packet[3 + i] = tick >= past ? g_LocalMoves[(tick - past) & HISTORY_MASK] : GAME_MOVE_NONE;
+    }
+    Queue(packet, sizeof(packet));
+}
+
+// Saves the state before the tick and plays it. The peer's move is a guess
+// of no move until it's confirmed.
+static void Play(uint32_t tick)
+{
+    uint8_t local = g_LocalMoves[tick & HISTORY_MASK];
+    uint8_t peer = tick < g_Confirmed ? g_PeerMoves[tick & HISTORY_MASK] : GAME_MOVE_NONE;
+    GameMoves moves = {
+        .Pacman = g_Pacman ? local : peer,
+        .Ghost = g_Pacman ? peer : local,
+    };
+
+    Game_SaveState(&g_States[tick & HISTORY_MASK]);
+    Game_UpdateMoves(&moves);
+}
+
+// Back to the first tick played on a wrong guess, and on to where the game was
+static void Rollback()
+{
+    uint32_t now = Game_GetTick(), depth = now - g_RollbackTick;
+    uint64_t start = i686_rdtsc();
+
+    Game_LoadState(&g_States[g_RollbackTick & HISTORY_MASK]);
+    for (uint32_t tick = g_RollbackTick; tick < now; tick++)
+        Play(tick);
+
+    uint32_t cycles = (uint32_t)(i686_rdtsc() - start);
+    g_Stats.Rollbacks++;
+    g_Stats.ReplayedTicks += depth;
+    g_Stats.ReplayCycles += cycles;
+    if (depth > g_Stats.MaxDepth)
+        g_Stats.MaxDepth = depth;
+    if (cycles > g_Stats.MaxReplayCycles)
+        g_Stats.MaxReplayCycles = cycles;
+    g_Rollback = false;
+}
+
+// The packet's moves, the tick in it is the last one's. The ones known
+// already are skipped, after a gap the rest wait for a later packet.
+static void OnMoves(uint16_t last, const uint8_t* moves)
+{
+    uint32_t tick = g_Confirmed + (int16_t)(last - (uint16_t)g_Confirmed) - (MOVES_PER_PACKET - 1);
+
+    for (int i = 0; i < MOVES_PER_PACKET; i++, tick++) {
+        if ((int32_t)tick < (int32_t)g_Confirmed)
+            continue;
+        if (tick != g_Confirmed || tick >= Game_GetTick() + NETPLAY_HISTORY - NETPLAY_MAX_ROLLBACK) {
+            g_Stats.BadPackets++;
+            return;
+        }
+
+        g_PeerMoves[tick & HISTORY_MASK] = moves[i];
+        g_Confirmed++;
+        if (tick < Game_GetTick() && moves[i] != GAME_MOVE_NONE && (!g_Rollback || tick < g_RollbackTick)) {
+            g_RollbackTick = tick;
+            g_Rollback = true;
+        }
+    }
+    g_Stats.Confirmed = g_Confirmed;
+}
+
+static void OnByte(uint8_t byte)
+{
+    // between packets anything but a packet start is noise
+    if (g_PacketSize == 0 && byte != PACKET_HELLO && byte != PACKET_MOVES)
+        return;
+
+    g_Packet[g_PacketSize++] = byte;
+    int size = g_Packet[0] == PACKET_HELLO ? HELLO_SIZE : MOVES_SIZE;
+    if (g_PacketSize < size)
+        return;
+    g_PacketSize = 0;
+
+    uint8_t check = 0;
+    for (int i = 0; i < size - 1; i++)
+        check ^= g_Packet[i];
+    if (check != g_Packet[size - 1]) {
+        g_Stats.BadPackets++;
+        return;
+    }
+
+    if (g_Packet[0] == PACKET_HELLO) {
+        // the peer's answer to our hello comes again once the game started
+        if (!g_Started) {
+            g_PeerNonce = g_Packet[1] | (g_Packet[2] << 8) | (g_Packet[3] << 16) | ((uint32_t)g_Packet[4] << 24);
+            g_PeerHello = true;
+        }
+    }
+    else if (g_Started) {
+        OnMoves(g_Packet[1] | (g_Packet[2] << 8), &g_Packet[3]);
+    }
+}
+
+uint32_t Netplay_Connect(const LinkDriver* link, uint32_t nonce, bool* pacman)
+{
+    uint8_t byte;
+
+    g_Link = link;
+    g_Started = false;
+    g_PeerHello = false;
+    g_PacketSize = 0;
+    g_SendHead = g_SendTail = 0;
+    g_Stats = (NetplayStats){ 0 };
+    g_Link->Initialize();
+    log_info(MODULE, "waiting for the peer on %s", g_Link->Name);
+
+    // byte by byte, what follows the peer's hello is the game's
+    for (uint32_t polls = 0; !g_PeerHello; polls++) {
+        if (polls % HELLO_PERIOD == 0)
+            SendHello(nonce);
+        Flush();
+        if (g_Link->Receive(&byte)) {
+            g_Stats.BytesReceived++;
+            OnByte(byte);
+        }
+    }
+
+    // the answer, in case the peer missed the hellos sent before it was up
+    SendHello(nonce);
+    Flush();
+
+    *pacman = nonce > g_PeerNonce;
+    log_info(MODULE, "connected, playing %s", *pacman ? "pacman" : "the ghost");
+    return *pacman ? nonce : g_PeerNonce;
+}
+
+void Netplay_Start(bool pacman)
+{
+    g_Pacman = pacman;
+    g_Started = true;
+    g_Confirmed = 0;
+    g_Rollback = false;
+    g_Stalled = false;
+}
+
+void Netplay_Poll()
+{
+    uint8_t byte;
+
+    while (g_Link->Receive(&byte)) {
+        g_Stats.BytesReceived++;
+        OnByte(byte);
+    }
+    if (g_Rollback)
+        Rollback();
+    Flush();
+}
+
+bool Netplay_Update(uint8_t move)
+{
+    Netplay_Poll();
+
+    uint32_t tick = Game_GetTick();
+    if (tick >= g_Confirmed + NETPLAY_MAX_ROLLBACK) {
+        g_Stats.Stalls += !g_Stalled;
+        g_Stalled = true;
+        return false;
+    }
+    g_Stalled = false;
+
+    g_LocalMoves[tick & HISTORY_MASK] = move;
+    SendMoves(tick);
+    Flush();
+    Play(tick);
+    g_Stats.Ticks++;
+    return true;
+}
+
+const NetplayStats* Netplay_GetStats()
+{
+    return &g_Stats;
+}
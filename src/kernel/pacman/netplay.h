@@ -0,0 +1,68 @@
+#pragma once
+#include "game.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+// Two players on two machines linked by a serial line, pacman on one and
+// the first ghost on the other. Both run the whole game from the same seed
+// and only the moves go over the line. The peer's move of a tick is taken
+// to be no move until it arrives. When it turns out to be one, the game
+// goes back to its snapshot of that tick and plays the ticks since again,
+// so neither side waits a round trip for its own moves.
+//
+// Protocol, the same both ways:
+//   HELLO  0x5A, nonce (4 bytes, little endian), check
+//          sent until the peer's arrives, then once more. The larger nonce
+//          plays pacman and is the seed of the game.
+//   MOVES  0xA5, tick (2 bytes, little endian), moves of the ticks tick-2,
+//          tick-1 and tick, check
+//          one per tick. The moves of the two ticks before ride along, a
+//          packet lost on the line costs nothing as long as the next arrives.
+// The check is the xor of the bytes before it, the first one included.
+
+#define NETPLAY_MAX_ROLLBACK    8   // ticks played ahead of the peer's moves before waiting for them
+#define NETPLAY_HISTORY         32  // ticks of snapshots and moves kept, a power of 2 over twice the rollback
+
+#if NETPLAY_HISTORY <= 2 * NETPLAY_MAX_ROLLBACK || (NETPLAY_HISTORY & (NETPLAY_HISTORY - 1))
+#error "The history has to cover the rollback both ways"
+#endif
+
+// The line to the peer: the serial port in the kernel, a pipe on the host
+typedef struct {
+    const char* Name;
+    void (*Initialize)();
+    bool (*Send)(uint8_t byte);         // false if the line can't take it now
+    bool (*Receive)(uint8_t* byte);     // false if nothing arrived
+} LinkDriver;
+
+typedef struct {
+    uint32_t Ticks;             // ticks played for the first time
+    uint32_t Confirmed;         // the ticks the peer's moves are known for
+    uint32_t Stalls;            // ticks that waited for the peer
+    uint32_t Rollbacks;         // mispredicted moves that sent the game back
+    uint32_t ReplayedTicks;     // ticks played again
+    uint32_t MaxDepth;          // the most ticks played again at once
+    uint64_t ReplayCycles;      // the time spent going back and playing again
+    uint32_t MaxReplayCycles;
+    uint32_t BytesSent;
+    uint32_t BytesReceived;
+    uint32_t BadPackets;        // failed the check or came out of order
+} NetplayStats;
+
+// Says hello until the peer answers. Returns the seed of the session and
+// whether this side plays pacman.
+uint32_t Netplay_Connect(const LinkDriver* link, uint32_t nonce, bool* pacman);
+
+// After Game_Initialize() with the session's seed and TwoPlayer
+void Netplay_Start(bool pacman);
+
+// Plays the next tick with the local move, a Direction or GAME_MOVE_NONE.
+// Returns false if the peer is too far behind, then the move has to be
+// tried again on the next tick.
+bool Netplay_Update(uint8_t move);
+
+// Takes in what arrived from the peer and rolls back if it has to, and
+// sends what waits to go out. Netplay_Update() does it too.
+void Netplay_Poll();
+
+const NetplayStats* Netplay_GetStats();
@@ -0,0 +1,60 @@
+#include "pellets.h"
+
+Pellets g_Pellets;
+
+void Pellets_Load()
+{
+    Bitboard_Clear(&g_Pellets.Dots);
+    Bitboard_Clear(&g_Pellets.Powers);
+
+    for (int i = 0; i < MAZE_CELLS; i++) {
+        if (Maze_Tile(i) == TILE_DOT)
+            Bitboard_Set(&g_Pellets.Dots, i);
+        else if (Maze_Tile(i) == TILE_POWER)
+            Bitboard_Set(&g_Pellets.Powers, i);
+    }
+
+    g_Pellets.Remaining = Bitboard_Count(&g_Pellets.Dots) + Bitboard_Count(&g_Pellets.Powers);
+}
+
+void Pellets_LoadBitboards(const Bitboard* dots, const Bitboard* powers)
+{
+    g_Pellets.Dots = *dots;
+    g_Pellets.Powers = *powers;
+    g_Pellets.Remaining = Bitboard_Count(dots) + Bitboard_Count(powers);
+}
+
+Tile Pellets_Eat(int cell)
+{
+    Tile eaten;
+
+    if (Bitboard_Test(&g_Pellets.Dots, cell)) {
+        Bitboard_Reset(&g_Pellets.Dots, cell);
+        eaten = TILE_DOT;
+    }
+    else if (Bitboard_Test(&g_Pellets.Powers, cell)) {
+        Bitboard_Reset(&g_Pellets.Powers, cell);
+        eaten = TILE_POWER;
+    }
+    else {
+        return TILE_PATH;
+    }
+
+    // the path stays a path, so no exits change and Maze_SetTile() doesn't relink
+    Maze_SetTile(cell, TILE_PATH);
+    g_Pellets.Remaining--;
+    return eaten;
+}
+
+void Pellets_Restore(const Pellets* saved)
+{
+    static Bitboard changed;
+
+    for (int i = 0; i < BITBOARD_WORDS; i++)
+        changed.Words[i] = (g_Pellets.Dots.Words[i] ^ saved->Dots.Words[i])
+                         | (g_Pellets.Powers.Words[i] ^ saved->Powers.Words[i]);
+
+    BITBOARD_FOREACH(&changed, cell, Maze_SetTile(cell, Bitboard_Test(&saved->Dots, cell) ? TILE_DOT
+        : Bitboard_Test(&saved->Powers, cell) ? TILE_POWER : TILE_PATH));
+    g_Pellets = *saved;
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include "maze.h"
+#include "bitboard.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define PELLET_DOT_SCORE        10
+#define PELLET_POWER_SCORE      50
+
+// The pellets left in the maze, one bit per cell next to the maze bitboards
+typedef struct {
+    Bitboard Dots;
+    Bitboard Powers;
+    uint16_t Remaining;     // counted once on load, then one less per pellet eaten
+} Pellets;
+
+extern Pellets g_Pellets;
+
+// Takes the dots and the power pellets from the maze tiles
+void Pellets_Load();
+
+// The same from the pellet bitboards of a level file, the tiles are already in the maze
+void Pellets_LoadBitboards(const Bitboard* dots, const Bitboard* powers);
+
+// Eats what is on the cell: clears its bit and turns the tile into a path.
+// Returns the tile that was eaten, TILE_PATH if there was nothing.
+Tile Pellets_Eat(int cell);
+
+// Goes back to pellets saved earlier on the same maze: the cells where they
+// differ get their pellet back or lose it, tile and bit
+void Pellets_Restore(const Pellets* saved);
+
+static inline bool Pellets_Cleared()
+{
+    return g_Pellets.Remaining == 0;
+}
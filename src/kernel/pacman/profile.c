@@ -0,0 +1,141 @@
+#include "profile.h"
+#include <arch/i686/io.h>
+#include <debug.h>
+#include <stdint.h>
+
+#define MODULE  "PROFILE"
+#define PROFILE_MOVES           8   // moves of one tick followed to the screen, more are only counted as queued
+
+// Nothing to link without PACMAN_PROFILE, not even the histograms
+#ifdef PACMAN_PROFILE
+
+static const char* const g_StageNames[PROFILE_STAGES] = {
+    "input", "draw", "ghosts", "collision", "step", "wait", "irq0", "irq1", "queue", "latency"
+};
+
+static ProfileHistogram g_Histograms[PROFILE_STAGES];
+static uint32_t g_DeadlineMisses;
+
+// The IRQ timestamps of the moves waiting for their frame
+static uint64_t g_Moves[PROFILE_MOVES];
+static int g_MoveCount;
+
+// Values below 4 get a bucket each, then every power of two gets 4,
+// indexed by the two bits below the leading one
+static uint32_t Bucket(uint32_t cycles)
+{
+    if (cycles < PROFILE_SUB_BUCKETS)
+        return cycles;
+
+    uint32_t log2 = 31 - __builtin_clz(cycles);
+    uint32_t sub = (cycles >> (log2 - 2)) & (PROFILE_SUB_BUCKETS - 1);
+    return (log2 - 1) * PROFILE_SUB_BUCKETS + sub;
+}
+
+// The largest value that falls in the bucket
+static uint32_t BucketLimit(uint32_t bucket)
+{
+    if (bucket < PROFILE_SUB_BUCKETS)
+        return bucket;
+
+    uint32_t log2 = bucket / PROFILE_SUB_BUCKETS + 1;
+    uint32_t sub = bucket % PROFILE_SUB_BUCKETS;
+    uint32_t low = (PROFILE_SUB_BUCKETS + sub) << (log2 - 2);
+    return low + ((1u << (log2 - 2)) - 1);
+}
+
+void Profile_Record(ProfileStage stage, uint64_t cycles)
+{
+    ProfileHistogram* histogram = &g_Histograms[stage];
+    uint32_t value = cycles > 0xFFFFFFFF ? 0xFFFFFFFF : (uint32_t)cycles;
+
+    if (histogram->Count == 0 || value < histogram->Min)
+        histogram->Min = value;
+    if (value > histogram->Max)
+        histogram->Max = value;
+    histogram->Count++;
+    histogram->Buckets[Bucket(value)]++;
+}
+
+void Profile_DeadlineMiss()
+{
+    g_DeadlineMisses++;
+}
+
+void Profile_Move(uint64_t timestamp)
+{
+    uint64_t now = i686_rdtsc();
+    Profile_Record(PROFILE_QUEUE, now - timestamp);
+    if (g_MoveCount < PROFILE_MOVES)
+        g_Moves[g_MoveCount++] = timestamp;
+}
+
+void Profile_Presented()
+{
+    uint64_t now = i686_rdtsc();
+    for (int i = 0; i < g_MoveCount; i++)
+        Profile_Record(PROFILE_LATENCY, now - g_Moves[i]);
+    g_MoveCount = 0;
+}
+
+uint32_t Profile_Percentile(const ProfileHistogram* histogram, uint32_t perMille)
+{
+    // the first bucket with perMille of the samples at or below it, no division needed
+    uint64_t target = (uint64_t)histogram->Count * perMille;
+    uint32_t seen = 0;
+
+    if (histogram->Count == 0)
+        return 0;
+
+    for (uint32_t i = 0; i < PROFILE_BUCKETS; i++) {
+        seen += histogram->Buckets[i];
+        if (seen != 0 && (uint64_t)seen * 1000 >= target) {
+            uint32_t limit = BucketLimit(i);
+            return limit < histogram->Max ? limit : histogram->Max;
+        }
+    }
+    return histogram->Max;
+}
+
+const ProfileHistogram* Profile_GetHistogram(ProfileStage stage)
+{
+    return &g_Histograms[stage];
+}
+
+void Profile_Dump()
+{
+    static ProfileHistogram histograms[PROFILE_STAGES];
+
+    // the IRQ stages record from their handlers, one that came in halfway
+    // through the reset would leave the count out of step with the buckets
+    i686_DisableInterrupts();
+    for (int i = 0; i < PROFILE_STAGES; i++) {
+        ProfileHistogram* histogram = &g_Histograms[i];
+        histograms[i].Count = histogram->Count;
+        histograms[i].Min = histogram->Min;
+        histograms[i].Max = histogram->Max;
+        for (int b = 0; b < PROFILE_BUCKETS; b++) {
+            histograms[i].Buckets[b] = histogram->Buckets[b];
+            histogram->Buckets[b] = 0;
+        }
+        histogram->Count = 0;
+        histogram->Min = 0;
+        histogram->Max = 0;
+    }
+    uint32_t deadlineMisses = g_DeadlineMisses;
+    g_DeadlineMisses = 0;
+    i686_EnableInterrupts();
+
+    log_info(MODULE, "%u deadline misses", deadlineMisses);
+    for (int i = 0; i < PROFILE_STAGES; i++) {
+        const ProfileHistogram* histogram = &histograms[i];
+        if (histogram->Count == 0)
+            continue;
+
+        log_info(MODULE, "%s: %u samples, cycles min %u p50 %u p99 %u max %u", g_StageNames[i],
+            histogram->Count, histogram->Min, Profile_Percentile(histogram, 500),
+            Profile_Percentile(histogram, 990), histogram->Max);
+    }
+}
+
+#endif
@@ -0,0 +1,68 @@
+#pragma once
+#include <stdint.h>
+
+// The stages of a frame, timed with the TSC when the kernel is built with
+// PACMAN_PROFILE (make PROFILE=1). Without it the macros below are no-ops
+// and the profiler costs nothing.
+typedef enum {
+    PROFILE_INPUT,          // polling the driver and applying the events
+    PROFILE_DRAW,           // Game_Render, the diff and the flip
+    PROFILE_GHOSTS,
+    PROFILE_COLLISION,      // finding and applying the collisions
+    PROFILE_STEP,           // the whole of Game_Update, a simulation tick
+    PROFILE_WAIT,           // waiting for the timer
+    PROFILE_IRQ_TIMER,
+    PROFILE_IRQ_KBD,
+    PROFILE_QUEUE,          // from the key's IRQ to the tick that applies it
+    PROFILE_LATENCY,        // from the key's IRQ to the flip of the frame that shows the move
+    PROFILE_STAGES,
+} ProfileStage;
+
+// Log-linear buckets: a power of two split in 4, so a percentile is off by 25% at most
+#define PROFILE_SUB_BUCKETS     4
+#define PROFILE_BUCKETS         (32 * PROFILE_SUB_BUCKETS)
+
+typedef struct {
+    uint32_t Count;
+    uint32_t Min;
+    uint32_t Max;
+    uint32_t Buckets[PROFILE_BUCKETS];
+} ProfileHistogram;
+
+#ifdef PACMAN_PROFILE
+#include <arch/i686/tsc.h>
+
+#define PROFILE_BEGIN(stage)        uint64_t profile_##stage = i686_rdtsc()
+#define PROFILE_END(stage)          Profile_Record(PROFILE_##stage, i686_rdtsc() - profile_##stage)
+#define PROFILE_DEADLINE(missed)    do { if (missed) Profile_DeadlineMiss(); } while (0)
+#define PROFILE_DUMP()              Profile_Dump()
+#define PROFILE_MOVE(timestamp)     Profile_Move(timestamp)
+#define PROFILE_PRESENTED()         Profile_Presented()
+#else
+#define PROFILE_BEGIN(stage)        ((void)0)
+#define PROFILE_END(stage)          ((void)0)
+#define PROFILE_DEADLINE(missed)    ((void)0)
+#define PROFILE_DUMP()              ((void)0)
+#define PROFILE_MOVE(timestamp)     ((void)0)
+#define PROFILE_PRESENTED()         ((void)0)
+#endif
+
+void Profile_Record(ProfileStage stage, uint64_t cycles);
+
+// The frame's work took longer than the tick period
+void Profile_DeadlineMiss();
+
+// The latency tracer: the game applied a move from a key the IRQ handler got
+// at timestamp, then the frame that shows it was flipped to the screen
+void Profile_Move(uint64_t timestamp);
+void Profile_Presented();
+
+// Logs min, p50, p99 and max of every stage since the last dump, then starts
+// over. The histograms are taken and cleared with the interrupts off, call
+// it from the main loop.
+void Profile_Dump();
+
+const ProfileHistogram* Profile_GetHistogram(ProfileStage stage);
+
+// The cycles below which the given per mille of the samples fall, rounded up to the bucket
+uint32_t Profile_Percentile(const ProfileHistogram* histogram, uint32_t perMille);
@@ -0,0 +1,160 @@
+#include "render.h"
+#include <stdbool.h>
+
+#define RENDER_CELLS            (RENDER_ROWS * RENDER_COLS)
+#define RENDER_PAGES            2
+#define SHADOW_UNKNOWN          0xFFFF  // never produced by the engine, forces the first write
+
+// The background (maze) layer, changes only when the maze changes
+static uint16_t g_Tiles[RENDER_CELLS];
+
+// Sprites drawn this frame, 0 if the cell has no sprite on it.
+// Sprites last one frame, the cells they covered are revisited on the next present.
+static uint16_t g_Overlay[RENDER_CELLS];
+static uint16_t g_SpriteCells[RENDER_CELLS];
+static int g_SpriteCount;
+
+// What each video page currently holds
+static uint16_t g_Shadow[RENDER_PAGES][RENDER_CELLS];
+
+// With two pages the back page is one frame behind, so the cells that
+// changed in the previous frame have to be revisited as well
+static bool g_Dirty[RENDER_CELLS];
+static uint16_t g_DirtyLists[2][RENDER_CELLS];
+static uint16_t* g_DirtyCells = g_DirtyLists[0];
+static uint16_t* g_PrevDirtyCells = g_DirtyLists[1];
+static int g_DirtyCount;
+static int g_PrevDirtyCount;
+
+static const RenderDriver* g_Driver;
+static RenderStats g_Stats;
+
+static void MarkDirty(int cell)
+{
+    if (!g_Dirty[cell]) {
+        g_Dirty[cell] = true;
+        g_DirtyCells[g_DirtyCount++] = cell;
+    }
+}
+
+void Render_Initialize(const RenderDriver* driver, bool waitRetrace)
+{
+    g_Driver = driver;
+    for (int i = 0; i < RENDER_CELLS; i++) {
+        g_Tiles[i] = 0;
+        g_Overlay[i] = 0;
+        g_Dirty[i] = false;
+        for (int page = 0; page < RENDER_PAGES; page++)
+            g_Shadow[page][i] = SHADOW_UNKNOWN;
+    }
+    g_SpriteCount = 0;
+    g_DirtyCount = 0;
+    g_PrevDirtyCount = 0;
+
+    // draw off-screen, the visible page is only ever replaced by a flip
+    g_Driver->Initialize(RENDER_PAGES, waitRetrace);
+
+    g_Stats.Frames = 0;
+    g_Stats.CellsWritten = 0;
+    g_Stats.LastFrameCells = 0;
+    g_Stats.MaxFrameCells = 0;
+}
+
+void Render_SetTile(int x, int y, uint16_t cell)
+{
+    if (x < 0 || x >= RENDER_COLS || y < 0 || y >= RENDER_ROWS)
+        return;
+
+    int i = y * RENDER_COLS + x;
+    if (g_Tiles[i] != cell) {
+        g_Tiles[i] = cell;
+        MarkDirty(i);
+    }
+}
+
+void Render_DrawSprite(int x, int y, uint16_t cell)
+{
+    if (x < 0 || x >= RENDER_COLS || y < 0 || y >= RENDER_ROWS)
+        return;
+
+    int i = y * RENDER_COLS + x;
+    if (g_Overlay[i] == 0)
+        g_SpriteCells[g_SpriteCount++] = i;
+    g_Overlay[i] = cell;
+    MarkDirty(i);
+}
+
+void Render_Scroll(int dx, int dy, int width, int height)
+{
+    // in the order that reads every tile before it is overwritten
+    bool forward = dy * RENDER_COLS + dx > 0;
+
+    for (int row = 0; row < height; row++) {
+        int y = forward ? row : height - 1 - row;
+        for (int col = 0; col < width; col++) {
+            int x = forward ? col : width - 1 - col;
+            int fromX = x + dx, fromY = y + dy;
+            if (fromX < 0 || fromX >= width || fromY < 0 || fromY >= height)
+                continue;
+
+            int i = y * RENDER_COLS + x;
+            uint16_t cell = g_Tiles[fromY * RENDER_COLS + fromX];
+            if (g_Tiles[i] != cell) {
+                g_Tiles[i] = cell;
+                MarkDirty(i);
+            }
+        }
+    }
+}
+
+uint32_t Render_Present()
+{
+    uint32_t written = 0;
+    uint16_t* shadow = g_Shadow[g_Driver->BackPage()];
+
+    // only the cells changed by this frame are carried over to the next one
+    int changed = g_DirtyCount;
+    for (int n = 0; n < g_PrevDirtyCount; n++)
+        MarkDirty(g_PrevDirtyCells[n]);
+
+    for (int n = 0; n < g_DirtyCount; n++) {
+        int i = g_DirtyCells[n];
+        uint16_t cell = g_Overlay[i] ? g_Overlay[i] : g_Tiles[i];
+        if (cell != shadow[i]) {
+            g_Driver->PutCell(i % RENDER_COLS, i / RENDER_COLS, cell);
+            shadow[i] = cell;
+            written++;
+        }
+        g_Dirty[i] = false;
+    }
+
+    uint16_t* swap = g_PrevDirtyCells;
+    g_PrevDirtyCells = g_DirtyCells;
+    g_PrevDirtyCount = changed;
+    g_DirtyCells = swap;
+    g_DirtyCount = 0;
+
+    g_Driver->Flip();
+
+    // The sprites have to be drawn again for the next frame, otherwise
+    // the cells they covered fall back to the tiles
+    for (int n = 0; n < g_SpriteCount; n++) {
+        int i = g_SpriteCells[n];
+        g_Overlay[i] = 0;
+        MarkDirty(i);
+    }
+    g_SpriteCount = 0;
+
+    g_Stats.Frames++;
+    g_Stats.CellsWritten += written;
+    g_Stats.LastFrameCells = written;
+    if (written > g_Stats.MaxFrameCells)
+        g_Stats.MaxFrameCells = written;
+
+    return written;
+}
+
+const RenderStats* Render_GetStats()
+{
+    return &g_Stats;
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+#define RENDER_ROWS             25
+#define RENDER_COLS             80
+
+// A screen cell is the character in the low byte and the VGA attribute in the high byte
+#define RENDER_CELL(chr, color) ((uint16_t)((((uint16_t)(uint8_t)(color)) << 8) | (uint8_t)(chr)))
+
+// Where the frames go: the VGA text pages in the kernel, nowhere in the host benchmark.
+// The renderer keeps what each of the pages holds and only asks to write the changed cells.
+typedef struct {
+    const char* Name;
+    void (*Initialize)(int pages, bool waitRetrace);
+    int (*BackPage)();                              // the page being drawn, not on the screen
+    void (*PutCell)(int x, int y, uint16_t cell);   // on the back page
+    void (*Flip)();                                 // shows the back page
+} RenderDriver;
+
+typedef struct {
+    uint32_t Frames;
+    uint32_t CellsWritten;      // cells written to video memory since initialization
+    uint32_t LastFrameCells;    // cells written by the last Render_Present()
+    uint32_t MaxFrameCells;
+} RenderStats;
+
+void Render_Initialize(const RenderDriver* driver, bool waitRetrace);
+void Render_SetTile(int x, int y, uint16_t cell);
+void Render_DrawSprite(int x, int y, uint16_t cell);
+
+// Moves the tiles of the width x height cells in the top left corner by dx
+// columns and dy rows, the tile at x + dx, y + dy goes to x, y: a view
+// scrolling over a larger maze. The cells coming into view keep their old
+// tiles until the caller draws them, the ones that changed are written on
+// the next present.
+void Render_Scroll(int dx, int dy, int width, int height);
+uint32_t Render_Present();
+const RenderStats* Render_GetStats();
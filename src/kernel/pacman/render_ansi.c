@@ -0,0 +1,295 @@
+#include "render_ansi.h"
+#include <arch/i686/uart.h>
+#include <stdbool.h>
+
+#define ANSI_PORT               UART_COM1
+#define ANSI_DIVISOR            1       // 115200 baud
+#define ANSI_CELLS              (RENDER_ROWS * RENDER_COLS)
+#define QUEUE_SIZE              2048    // a power of 2, about 180 ms of the line
+#define ROW_BYTES_MAX           (RENDER_COLS * 20)  // a move and both colors for every cell of a row, at most
+#define CURSOR_UNKNOWN          -1
+#define BLANK                   RENDER_CELL(' ', 0x07)
+#define ESC                     0x1B
+
+// The terminal set to gray on black and cleared, the cursor hidden
+static const char g_Reset[] = "\x1b[0m\x1b[?25l\x1b[37;40m\x1b[2J";
+
+// VGA's color order to ANSI's: black, blue, green, cyan, red, magenta, brown, gray
+static const uint8_t g_AnsiColors[8] = { 0, 4, 2, 6, 1, 5, 3, 7 };
+
+// What the terminal's cursor and colors are once the bytes queued are out
+typedef struct {
+    int X;
+    int Y;
+    uint8_t Foreground;
+    uint8_t Background;
+} Cursor;
+
+typedef struct {
+    uint8_t* Data;
+    uint32_t Size;
+} Output;
+
+static uint16_t g_Screen[ANSI_CELLS];       // what the frames drew
+static uint16_t g_Terminal[ANSI_CELLS];     // what the terminal shows once the bytes queued are out
+static bool g_RowDirty[RENDER_ROWS];        // the row has cells where the two differ
+static int g_FirstRow;                      // the row the next frame starts with, so none waits forever
+static Cursor g_Cursor;
+
+// The bytes on their way to the UART, the counts run free
+static uint8_t g_Queue[QUEUE_SIZE];
+static uint32_t g_Head;
+static uint32_t g_Tail;
+
+static uint8_t g_Row[ROW_BYTES_MAX];
+static RenderAnsiStats g_Stats;
+
+static void Put(Output* out, uint8_t byte)
+{
+    out->Data[out->Size++] = byte;
+}
+
+static void PutNumber(Output* out, uint32_t value)
+{
+    char digits[10];
+    int count = 0;
+
+    do {
+        digits[count++] = '0' + value % 10;
+        value /= 10;
+    } while (value > 0);
+    while (count > 0)
+        Put(out, digits[--count]);
+}
+
+static uint32_t NumberLength(uint32_t value)
+{
+    return value >= 100 ? 3 : value >= 10 ? 2 : 1;
+}
+
+// The terminal gets printable ASCII only, the rest of code page 437 shows as #
+static uint8_t Glyph(uint16_t cell)
+{
+    uint8_t chr = cell & 0xFF;
+    if (chr == 0)
+        return ' ';
+    return chr >= 0x20 && chr < 0x7F ? chr : '#';
+}
+
+// The shortest way to x, y: nothing, the cells in between written again
+// when they're fewer bytes than a forward move and need no color change,
+// a forward move, a new line or the full position
+static void Move(Output* out, Cursor* cursor, int x, int y)
+{
+    if (cursor->Y == y && cursor->X == x)
+        return;
+
+    if (cursor->Y == y && cursor->X >= 0 && x > cursor->X) {
+        int gap = x - cursor->X;
+        uint32_t forward = gap == 1 ? 3 : 3 + NumberLength(gap);
+        const uint16_t* cells = &g_Terminal[y * RENDER_COLS];
+        bool plain = (uint32_t)gap < forward;
+
+        for (int i = cursor->X; plain && i < x; i++)
+            plain = (cells[i] >> 8) == (cursor->Background << 4 | cursor->Foreground);
+        if (plain) {
+            for (int i = cursor->X; i < x; i++)
+                Put(out, Glyph(cells[i]));
+        }
+        else {
+            Put(out, ESC);
+            Put(out, '[');
+            if (gap > 1)
+                PutNumber(out, gap);
+            Put(out, 'C');
+        }
+    }
+    else if (x == 0 && cursor->Y >= 0 && cursor->Y == y - 1) {
+        Put(out, '\r');
+        Put(out, '\n');
+    }
+    else {
+        Put(out, ESC);
+        Put(out, '[');
+        PutNumber(out, y + 1);
+        if (x > 0) {
+            Put(out, ';');
+            PutNumber(out, x + 1);
+        }
+        Put(out, 'H');
+    }
+    cursor->X = x;
+    cursor->Y = y;
+}
+
+// One SGR sequence with the colors that changed, the high bits are the bright ones
+static void SetColors(Output* out, Cursor* cursor, uint8_t attribute)
+{
+    uint8_t foreground = attribute & 0xF, background = attribute >> 4;
+    bool fg = foreground != cursor->Foreground, bg = background != cursor->Background;
+    if (!fg && !bg)
+        return;
+
+    Put(out, ESC);
+    Put(out, '[');
+    if (fg)
+        PutNumber(out, (foreground & 8 ? 90 : 30) + g_AnsiColors[foreground & 7]);
+    if (fg && bg)
+        Put(out, ';');
+    if (bg)
+        PutNumber(out, (background & 8 ? 100 : 40) + g_AnsiColors[background & 7]);
+    Put(out, 'm');
+
+    cursor->Foreground = foreground;
+    cursor->Background = background;
+}
+
+// The changed cells of the row, left to right, into g_Row. Returns the byte count.
+static uint32_t EncodeRow(int y, Cursor* cursor)
+{
+    Output out = { g_Row, 0 };
+    const uint16_t* screen = &g_Screen[y * RENDER_COLS];
+    const uint16_t* terminal = &g_Terminal[y * RENDER_COLS];
+
+    for (int x = 0; x < RENDER_COLS; x++) {
+        if (screen[x] == terminal[x])
+            continue;
+
+        Move(&out, cursor, x, y);
+        SetColors(&out, cursor, screen[x] >> 8);
+        Put(&out, Glyph(screen[x]));
+
+        // past the last column the terminal waits to wrap, a move sorts that out
+        if (++cursor->X == RENDER_COLS) {
+            cursor->X = CURSOR_UNKNOWN;
+            cursor->Y = CURSOR_UNKNOWN;
+        }
+    }
+    return out.Size;
+}
+
+static void Enqueue(const uint8_t* data, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++)
+        g_Queue[(g_Head + i) & (QUEUE_SIZE - 1)] = data[i];
+    g_Head += size;
+    if (g_Head - g_Tail > g_Stats.QueueHighWater)
+        g_Stats.QueueHighWater = g_Head - g_Tail;
+}
+
+// As much of the queue as the UART takes without waiting
+static void Drain()
+{
+    while (g_Head != g_Tail) {
+        uint32_t start = g_Tail & (QUEUE_SIZE - 1), count = g_Head - g_Tail;
+        if (count > QUEUE_SIZE - start)
+            count = QUEUE_SIZE - start;
+
+        uint32_t sent = i686_UART_Write(ANSI_PORT, &g_Queue[start], count);
+        if (sent == 0)
+            return;
+        g_Tail += sent;
+        g_Stats.Sent += sent;
+    }
+}
+
+static void RenderAnsi_Initialize(int pages, bool waitRetrace)
+{
+    // one page whatever was asked for, and no retrace to wait for: the
+    // engine's main loop draws a frame a timer tick (WaitForTimer())
+    i686_UART_Initialize(ANSI_PORT, ANSI_DIVISOR);
+
+    g_Head = 0;
+    g_Tail = 0;
+    Enqueue((const uint8_t*)g_Reset, sizeof(g_Reset) - 1);
+    g_Cursor.X = CURSOR_UNKNOWN;
+    g_Cursor.Y = CURSOR_UNKNOWN;
+    g_Cursor.Foreground = BLANK >> 8 & 0xF;
+    g_Cursor.Background = BLANK >> 12;
+
+    for (int i = 0; i < ANSI_CELLS; i++) {
+        g_Screen[i] = BLANK;
+        g_Terminal[i] = BLANK;
+    }
+    for (int y = 0; y < RENDER_ROWS; y++)
+        g_RowDirty[y] = false;
+    g_FirstRow = 0;
+
+    g_Stats.Frames = 0;
+    g_Stats.Bytes = 0;
+    g_Stats.LastFrameBytes = 0;
+    g_Stats.MaxFrameBytes = 0;
+    g_Stats.Dropped = 0;
+    g_Stats.Sent = 0;
+    g_Stats.QueueHighWater = 0;
+}
+
+static int RenderAnsi_BackPage()
+{
+    return 0;
+}
+
+static void RenderAnsi_PutCell(int x, int y, uint16_t cell)
+{
+    int i = y * RENDER_COLS + x;
+    g_Screen[i] = cell;
+    if (cell != g_Terminal[i])
+        g_RowDirty[y] = true;
+}
+
+// The rows with changes go out as long as the queue has room for them
+// whole, starting where the last frame that ran out of room stopped
+static void RenderAnsi_Flip()
+{
+    uint32_t bytes = 0;
+    bool full = false;
+
+    Drain();
+    for (int n = 0; n < RENDER_ROWS; n++) {
+        int y = (g_FirstRow + n) % RENDER_ROWS;
+        if (!g_RowDirty[y])
+            continue;
+
+        Cursor cursor = g_Cursor;
+        uint32_t size = EncodeRow(y, &cursor);
+        if (size > QUEUE_SIZE - (g_Head - g_Tail)) {
+            g_FirstRow = y;
+            full = true;
+            break;
+        }
+
+        Enqueue(g_Row, size);
+        for (int x = 0; x < RENDER_COLS; x++)
+            g_Terminal[y * RENDER_COLS + x] = g_Screen[y * RENDER_COLS + x];
+        g_RowDirty[y] = false;
+        g_Cursor = cursor;
+        bytes += size;
+    }
+    Drain();
+
+    g_Stats.Frames++;
+    g_Stats.Bytes += bytes;
+    g_Stats.LastFrameBytes = bytes;
+    if (bytes > g_Stats.MaxFrameBytes)
+        g_Stats.MaxFrameBytes = bytes;
+    if (full)
+        g_Stats.Dropped++;
+}
+
+static const RenderDriver g_RenderAnsiDriver = {
+    .Name = "ANSI COM1",
+    .Initialize = &RenderAnsi_Initialize,
+    .BackPage = &RenderAnsi_BackPage,
+    .PutCell = &RenderAnsi_PutCell,
+    .Flip = &RenderAnsi_Flip,
+};
+
+const RenderDriver* RenderAnsi_GetDriver()
+{
+    return &g_RenderAnsiDriver;
+}
+
+const RenderAnsiStats* RenderAnsi_GetStats()
+{
+    return &g_Stats;
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include "render.h"
+
+// The screen as an ANSI/VT100 stream on COM1, for qemu -nographic where
+// the VGA text pages are out of sight. The driver keeps what the terminal
+// shows and sends only the cells that differ from it: a cursor move to
+// the first changed cell of a run, the colors when they change, the
+// characters. The bytes go through a queue the frames drain as they're
+// presented, and a frame that doesn't fit in what's left of it sends the
+// rows that do. The others wait for a later frame, which sends whatever
+// they hold by then, so the terminal catches up instead of falling behind.
+//
+// The link runs at 115200 baud, 8N1: 11520 bytes a second
+#define RENDER_ANSI_BYTES_PER_SECOND    11520
+
+typedef struct {
+    uint32_t Frames;
+    uint32_t Bytes;             // queued since initialization
+    uint32_t LastFrameBytes;
+    uint32_t MaxFrameBytes;
+    uint32_t Dropped;           // frames that left cells for later, the queue being full
+    uint32_t Sent;              // bytes the UART took
+    uint32_t QueueHighWater;    // the most bytes waiting for the line
+} RenderAnsiStats;
+
+const RenderDriver* RenderAnsi_GetDriver();
+const RenderAnsiStats* RenderAnsi_GetStats();
@@ -0,0 +1,31 @@
+#include "render_vga.h"
+#include "capture.h"
+#include <arch/i686/vga_text.h>
+
+static void RenderVGA_Initialize(int pages, bool waitRetrace)
+{
+    VGA_setpages(pages);
+    VGA_setvsync(waitRetrace);
+}
+
+// With make CAPTURE=1 the capture gets the page as it goes on the screen
+static void RenderVGA_Flip()
+{
+#ifdef PACMAN_CAPTURE
+    Capture_Frame(VGA_pagecells(VGA_backpage()));
+#endif
+    VGA_flip();
+}
+
+static const RenderDriver g_RenderVGADriver = {
+    .Name = "VGA text",
+    .Initialize = &RenderVGA_Initialize,
+    .BackPage = &VGA_backpage,
+    .PutCell = &VGA_putcell,
+    .Flip = &RenderVGA_Flip,
+};
+
+const RenderDriver* RenderVGA_GetDriver()
+{
+    return &g_RenderVGADriver;
+}
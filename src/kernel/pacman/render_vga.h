@@ -0,0 +1,5 @@
+#pragma once
+#include "render.h"
+
+// The VGA text mode pages, flipped on the vertical retrace
+const RenderDriver* RenderVGA_GetDriver();
@@ -0,0 +1,195 @@
+#include "replay.h"
+#include <arch/i686/tsc.h>
+#include <debug.h>
+
+#define MODULE                  "REPLAY"
+
+#define KIND_KEY                0
+#define KIND_EXTENDED_KEY       1
+#define KIND_END                2
+
+#define SCANCODE_EXTENDED       0xE0
+
+//
+// Recording
+//
+
+static uint8_t g_Buffer[REPLAY_BUFFER_SIZE];
+static uint32_t g_Size;
+static uint32_t g_Flushed;         // the bytes already given to the sink
+static uint32_t g_LastTick;        // the tick of the previous record
+static bool g_Recording;
+static ReplaySink g_Sink;
+
+static bool Put(uint8_t byte)
+{
+    if (g_Size == REPLAY_BUFFER_SIZE) {
+        log_err(MODULE, "The recording is full after %u bytes, stopped", g_Size);
+        g_Recording = false;
+        return false;
+    }
+    g_Buffer[g_Size++] = byte;
+    return true;
+}
+
+static void PutVarint(uint32_t value)
+{
+    while (value >= 0x80) {
+        Put((value & 0x7F) | 0x80);
+        value >>= 7;
+    }
+    Put(value);
+}
+
+static void PutRecord(uint32_t tick, int kind)
+{
+    PutVarint(((tick - g_LastTick) << 2) | kind);
+    g_LastTick = tick;
+}
+
+void Replay_StartRecording(uint32_t seed, uint8_t ghosts, ReplaySink sink)
+{
+    g_Size = 0;
+    g_Flushed = 0;
+    g_LastTick = 0;
+    g_Sink = sink;
+    g_Recording = true;
+
+    uint32_t magic = REPLAY_MAGIC;
+    for (int i = 0; i < 4; i++)
+        Put(magic >> (8 * i));
+    Put(REPLAY_VERSION);
+    Put(ghosts);
+    for (int i = 0; i < 4; i++)
+        Put(seed >> (8 * i));
+}
+
+void Replay_RecordEvent(uint32_t tick, const InputEvent* event)
+{
+    if (!g_Recording)
+        return;
+
+    PutRecord(tick, event->Extended ? KIND_EXTENDED_KEY : KIND_KEY);
+    Put(event->Scancode);
+}
+
+void Replay_StopRecording(uint32_t tick)
+{
+    if (!g_Recording)
+        return;
+
+    PutRecord(tick, KIND_END);
+    Replay_Flush();
+    g_Recording = false;
+}
+
+void Replay_Flush()
+{
+    if (g_Sink && g_Flushed < g_Size)
+        g_Sink(g_Buffer + g_Flushed, g_Size - g_Flushed);
+    g_Flushed = g_Size;
+}
+
+bool Replay_IsRecording()
+{
+    return g_Recording;
+}
+
+const uint8_t* Replay_GetRecording(uint32_t* size)
+{
+    *size = g_Size;
+    return g_Buffer;
+}
+
+//
+// Playback
+//
+
+static const uint8_t* g_Data;
+static uint32_t g_DataSize;
+static uint32_t g_Position;
+static uint32_t g_NextTick;        // the tick of the record at g_Position
+static int g_NextKind;
+
+static uint32_t GetVarint()
+{
+    uint32_t value = 0;
+    for (int shift = 0; g_Position < g_DataSize && shift < 32; shift += 7) {
+        uint8_t byte = g_Data[g_Position++];
+        value |= (uint32_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+            return value;
+    }
+
+    // a cut recording ends here
+    return KIND_END;
+}
+
+static void NextRecord()
+{
+    uint32_t value = GetVarint();
+    g_NextTick += value >> 2;
+    g_NextKind = value & 3;
+    if (g_NextKind != KIND_END && g_Position == g_DataSize)
+        g_NextKind = KIND_END;
+}
+
+bool Replay_Open(const uint8_t* data, uint32_t size, ReplayHeader* header)
+{
+    if (size < REPLAY_HEADER_SIZE)
+        return false;
+
+    uint32_t magic = data[0] | (data[1] << 8) | (data[2] << 16) | ((uint32_t)data[3] << 24);
+    if (magic != REPLAY_MAGIC || data[4] != REPLAY_VERSION)
+        return false;
+
+    header->Ghosts = data[5];
+    header->Seed = data[6] | (data[7] << 8) | (data[8] << 16) | ((uint32_t)data[9] << 24);
+
+    g_Data = data;
+    g_DataSize = size;
+    g_Position = REPLAY_HEADER_SIZE;
+    g_NextTick = 0;
+    NextRecord();
+    return true;
+}
+
+bool Replay_Finished(uint32_t tick)
+{
+    return g_NextKind == KIND_END && tick >= g_NextTick;
+}
+
+// Whatever the previous driver left in the queue isn't part of the recording
+static void Replay_Initialize()
+{
+    InputEvent event;
+    while (Input_Pop(&event));
+}
+
+static void Replay_Shutdown()
+{
+}
+
+// Pushes the events of the tick the way the keyboard IRQ delivered them
+static void Replay_Poll(uint32_t tick)
+{
+    while (g_NextKind != KIND_END && g_NextTick == tick) {
+        uint8_t scancode = g_Data[g_Position++];
+        if (g_NextKind == KIND_EXTENDED_KEY)
+            Input_OnScancode(SCANCODE_EXTENDED, i686_rdtsc());
+        Input_OnScancode(scancode, i686_rdtsc());
+        NextRecord();
+    }
+}
+
+static const InputDriver g_ReplayDriver = {
+    .Name = "replay",
+    .Initialize = &Replay_Initialize,
+    .Shutdown = &Replay_Shutdown,
+    .Poll = &Replay_Poll,
+};
+
+const InputDriver* Replay_GetDriver()
+{
+    return &g_ReplayDriver;
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include "input.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+// A recording is the seed, the ghost count and every input event with the
+// tick that applied it. The simulation depends on nothing else, so feeding
+// the events back through the replay input driver gives the same game.
+//
+// Format: a header (magic, version, ghosts, seed, little endian), then one
+// record per event: a varint of (ticks since the previous record << 2 | kind),
+// followed by the scancode for the key kinds. The end record has the tick count.
+#define REPLAY_MAGIC            0x50524D50  // "PMRP"
+#define REPLAY_VERSION          3           // 2: xoshiro128** and Random_Below() for the ghosts, 3: the ghost scripts, the respawn grace
+#define REPLAY_HEADER_SIZE      10
+#define REPLAY_BUFFER_SIZE      0x4000
+
+// Sends out a piece of the recording, e.g. to the debug port
+typedef void (*ReplaySink)(const uint8_t* data, uint32_t size);
+
+typedef struct {
+    uint32_t Seed;
+    uint8_t Ghosts;
+} ReplayHeader;
+
+// Recording, the buffer keeps all of it and the sink gets the new bytes on every flush
+void Replay_StartRecording(uint32_t seed, uint8_t ghosts, ReplaySink sink);
+void Replay_RecordEvent(uint32_t tick, const InputEvent* event);
+void Replay_StopRecording(uint32_t tick);
+void Replay_Flush();
+bool Replay_IsRecording();
+const uint8_t* Replay_GetRecording(uint32_t* size);
+
+// Playback, false if the data isn't a recording
+bool Replay_Open(const uint8_t* data, uint32_t size, ReplayHeader* header);
+bool Replay_Finished(uint32_t tick);
+const InputDriver* Replay_GetDriver();
@@ -0,0 +1,136 @@
+#include "random.h"
+#include <arch/i686/rdrand.h>
+#include <arch/i686/tsc.h>
+#include <debug.h>
+
+#define MODULE                  "RANDOM"
+
+#define RDRAND_RETRIES          10      // Intel's advice, failing 10 times in a row means the DRNG is broken
+#define RDSEED_RETRIES          32      // rdseed runs dry under load, it's worth waiting for a bit
+
+static bool g_HasRdrand;
+static bool g_HasRdseed;
+
+static uint32_t g_Pool[RANDOM_POOL_WORDS];
+static int g_PoolLeft;
+
+static RandomState g_State;
+static RandomStats g_Stats;
+
+// splitmix32, spreads a 32-bit seed over the generator state
+static uint32_t SplitMix(uint32_t* x)
+{
+    uint32_t z = (*x += 0x9E3779B9);
+    z = (z ^ (z >> 16)) * 0x85EBCA6B;
+    z = (z ^ (z >> 13)) * 0xC2B2AE35;
+    return z ^ (z >> 16);
+}
+
+static uint32_t EntropyWord()
+{
+    uint32_t value;
+
+    if (g_HasRdseed) {
+        for (int i = 0; i < RDSEED_RETRIES; i++) {
+            if (i686_Rdseed(&value)) {
+                g_Stats.RdseedWords++;
+                return value;
+            }
+            g_Stats.Retries++;
+            i686_Pause();
+        }
+    }
+
+    if (g_HasRdrand) {
+        for (int i = 0; i < RDRAND_RETRIES; i++) {
+            if (i686_Rdrand(&value)) {
+                g_Stats.RdrandWords++;
+                return value;
+            }
+            g_Stats.Retries++;
+        }
+    }
+
+    // no hardware, or it gave up: the low bits of the TSC jitter a little
+    uint64_t tsc = i686_rdtsc();
+    uint32_t mixed = (uint32_t)tsc ^ (uint32_t)(tsc >> 32) ^ (g_Stats.TscWords * 0x9E3779B9);
+    g_Stats.TscWords++;
+    return SplitMix(&mixed);
+}
+
+static void RefillPool()
+{
+    for (int i = 0; i < RANDOM_POOL_WORDS; i++)
+        g_Pool[i] = EntropyWord();
+    g_PoolLeft = RANDOM_POOL_WORDS;
+    g_Stats.Refills++;
+}
+
+void Random_Initialize()
+{
+    g_HasRdrand = i686_HasRdrand();
+    g_HasRdseed = i686_HasRdseed();
+    g_PoolLeft = 0;
+
+    if (!g_HasRdrand && !g_HasRdseed)
+        log_warn(MODULE, "The CPU doesn't provide rdrand/rdseed, the seeds come from the TSC");
+    else
+        log_info(MODULE, "Entropy from%s%s", g_HasRdseed ? " rdseed" : "", g_HasRdrand ? " rdrand" : "");
+
+    for (int i = 0; i < 4; i++)
+        g_State.Words[i] = Random_Entropy();
+
+    // the one state xoshiro can't leave
+    if ((g_State.Words[0] | g_State.Words[1] | g_State.Words[2] | g_State.Words[3]) == 0)
+        g_State.Words[0] = 1;
+}
+
+void Random_Seed(uint32_t seed)
+{
+    Random_SeedState(&g_State, seed);
+}
+
+void Random_SeedState(RandomState* state, uint32_t seed)
+{
+    uint32_t x = seed;
+    for (int i = 0; i < 4; i++)
+        state->Words[i] = SplitMix(&x);
+}
+
+uint32_t Random_Entropy()
+{
+    if (g_PoolLeft == 0)
+        RefillPool();
+    return g_Pool[--g_PoolLeft];
+}
+
+uint32_t Random_Next()
+{
+    return Random_NextState(&g_State);
+}
+
+uint32_t Random_Below(uint32_t n)
+{
+    return Random_BelowState(&g_State, n);
+}
+
+uint32_t Random_GetState()
+{
+    const uint32_t* s = g_State.Words;
+    return s[0] ^ Random_Rotl(s[1], 8) ^ Random_Rotl(s[2], 16) ^ Random_Rotl(s[3], 24);
+}
+
+void Random_Save(RandomState* state)
+{
+    *state = g_State;
+}
+
+void Random_Load(const RandomState* state)
+{
+    g_State = *state;
+}
+
+const RandomStats* Random_GetStats()
+{
+    return &g_Stats;
+}
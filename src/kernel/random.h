@@ -0,0 +1,94 @@
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+// Random numbers for the kernel and the game.
+//
+// The generator is xoshiro128**, a few shifts and rotates per draw with
+// 32-bit operations only. It's seeded either from the entropy pool, which
+// is refilled in batches from rdseed/rdrand, or from a fixed seed, then the
+// stream is the same on every run (replays, benchmarks, the host build).
+
+#define RANDOM_POOL_WORDS       32
+
+typedef struct {
+    uint32_t Refills;           // batches pulled into the entropy pool
+    uint32_t RdseedWords;
+    uint32_t RdrandWords;
+    uint32_t TscWords;          // words made up from the TSC, the hardware failed or is missing
+    uint32_t Retries;           // rdseed/rdrand calls that came back empty
+} RandomStats;
+
+// Looks for rdseed/rdrand and seeds the generator from the entropy pool
+void Random_Initialize();
+
+// Deterministic mode, the same seed gives the same stream
+void Random_Seed(uint32_t seed);
+
+// A word from the entropy pool, for seeds and keys rather than for the game
+uint32_t Random_Entropy();
+
+uint32_t Random_Next();
+
+// Uniform in [0, n) without the bias of Random_Next() % n, 0 for n == 0
+uint32_t Random_Below(uint32_t n);
+
+// A digest of the generator state, for the state hash of the game
+uint32_t Random_GetState();
+
+// The whole generator state, to go back to an earlier point of the stream
+typedef struct {
+    uint32_t Words[4];
+} RandomState;
+
+void Random_Save(RandomState* state);
+void Random_Load(const RandomState* state);
+
+// The same generator on a state of the caller's, for streams next to the
+// game's, e.g. one per batched game of src/host/batch.c. A state seeded
+// with a seed draws what Random_Seed() with it would.
+void Random_SeedState(RandomState* state, uint32_t seed);
+
+static inline uint32_t Random_Rotl(uint32_t x, int k)
+{
+    return (x << k) | (x >> (32 - k));
+}
+
+// xoshiro128** by Blackman and Vigna
+static inline uint32_t Random_NextState(RandomState* state)
+{
+    uint32_t* s = state->Words;
+    uint32_t result = Random_Rotl(s[1] * 5, 7) * 9;
+    uint32_t t = s[1] << 9;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = Random_Rotl(s[3], 11);
+
+    return result;
+}
+
+// Lemire's multiply and shift: the high word of x * n is in [0, n). The low
+// word tells when x fell into the few values that would favor some results,
+// those are drawn again. The division only runs when the low word is small.
+static inline uint32_t Random_BelowState(RandomState* state, uint32_t n)
+{
+    if (n == 0)
+        return 0;
+
+    uint64_t m = (uint64_t)Random_NextState(state) * n;
+    uint32_t low = (uint32_t)m;
+    if (low < n) {
+        uint32_t threshold = -n % n;
+        while (low < threshold) {
+            m = (uint64_t)Random_NextState(state) * n;
+            low = (uint32_t)m;
+        }
+    }
+    return m >> 32;
+}
+
+const RandomStats* Random_GetStats();
@@ -0,0 +1,30 @@
+#pragma once
+#include <stdint.h>
+
+// Stackless coroutines, protothread style: a function that yields returns,
+// and the next call jumps back to the line it yielded at through a switch.
+// There is no stack of its own, so locals don't live across a yield, what
+// has to goes next to the coroutine's state. A switch of the function's own
+// can't span a yield either, its cases would mix with the resume points.
+//
+//  void Blink(Blinker* b)
+//  {
+//      CO_BEGIN(&b->Co);
+//      for (;;) {
+//          for (b->Ticks = 0; b->Ticks < 10; b->Ticks++) { On(); CO_YIELD(&b->Co); }
+//          for (b->Ticks = 0; b->Ticks < 10; b->Ticks++) { Off(); CO_YIELD(&b->Co); }
+//      }
+//      CO_END(&b->Co);
+//  }
+
+typedef uint16_t Coroutine;     // the line to resume at, 0 to start from the top
+
+#define CO_BEGIN(co)            switch (*(co)) { case 0:
+
+// Returns from the function, the next call goes on after it
+#define CO_YIELD(co)            do { *(co) = __LINE__; return; case __LINE__:; } while (0)
+
+// Running off the end starts over on the next call
+#define CO_END(co)              } *(co) = 0
+
+#define CO_RESTART(co)          (*(co) = 0)
@@ -0,0 +1,18 @@
+#pragma once
+#include <stdint.h>
+
+// 64 by 32 bit division, without pulling libgcc's __udivdi3 into the kernel.
+// Saturates when the quotient doesn't fit in 32 bits.
+static inline uint32_t div64_32(uint64_t dividend, uint32_t divisor)
+{
+    uint32_t high = (uint32_t)(dividend >> 32);
+    if (high >= divisor)
+        return UINT32_MAX;
+#if defined(__i386__)
+    uint32_t quotient, remainder;
+    __asm__ ("divl %4" : "=a"(quotient), "=d"(remainder) : "a"((uint32_t)dividend), "d"(high), "rm"(divisor));
+    return quotient;
+#else
+    return (uint32_t)(dividend / divisor);
+#endif
+}